@@ -0,0 +1,56 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "bench.hpp"
+
+namespace {
+
+auto allocations = std::atomic<uint64_t>{0};
+
+}  // namespace
+
+namespace comb_bench {
+
+auto allocation_count() -> uint64_t {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace comb_bench
+
+auto operator new(size_t size) -> void* {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+auto operator new(size_t size, std::align_val_t align) -> void* {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    auto const alignment = (size_t) align;
+    auto const rounded_size = (size + alignment - 1) / alignment * alignment;
+
+    if (auto ptr = std::aligned_alloc(
+            alignment, rounded_size == 0 ? alignment : rounded_size
+        ))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, size_t) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::align_val_t) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, size_t, std::align_val_t) noexcept -> void {
+    std::free(ptr);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <fmt/format.h>
+
+namespace comb_bench {
+
+// number of calls to global `operator new` since program start
+auto allocation_count() -> uint64_t;
+
+struct BenchOptions {
+    double min_seconds = 1.0;
+    std::string_view filter = "";
+};
+
+struct BenchResult {
+    std::string name;
+    size_t input_size;
+    size_t n_runs;
+    double seconds;
+    uint64_t n_allocations;
+    bool ok;
+};
+
+inline auto print_header() -> void {
+    fmt::print(
+        "{:<40} {:>10} {:>8} {:>10} {:>12} {:>12}\n", "benchmark", "size, MB",
+        "runs", "MB/s", "parses/s", "allocs/run"
+    );
+}
+
+inline auto print_result(BenchResult const& result) -> void {
+    auto const megabytes = (double) result.input_size / (1024.0 * 1024.0);
+    auto const runs = (double) result.n_runs;
+
+    fmt::print(
+        "{:<40} {:>10.2f} {:>8} {:>10.1f} {:>12.1f} {:>12.1f}{}\n",
+        result.name, megabytes, result.n_runs,
+        megabytes * runs / result.seconds, runs / result.seconds,
+        (double) result.n_allocations / runs, result.ok ? "" : "  FAILED"
+    );
+}
+
+template <class T>
+inline auto do_not_optimize(T const& value) -> void {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs `parse(input)` until `options.min_seconds` elapsed (at least 3 times).
+// `parse` returns whether the whole input was parsed successfully.
+template <class F>
+inline auto run_bench(
+    std::string_view name, std::string_view input, BenchOptions options,
+    F parse
+) -> void {
+    using Clock = std::chrono::steady_clock;
+
+    if (name.find(options.filter) == std::string_view::npos) {
+        return;
+    }
+
+    auto ok = parse(input);
+
+    auto const start_allocations = allocation_count();
+    auto const start = Clock::now();
+    auto n_runs = size_t{0};
+    auto seconds = 0.0;
+
+    while (n_runs < 3 || seconds < options.min_seconds) {
+        ok = parse(input) && ok;
+        n_runs += 1;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    print_result(BenchResult{
+        .name = std::string{name},
+        .input_size = input.size(),
+        .n_runs = n_runs,
+        .seconds = seconds,
+        .n_allocations = allocation_count() - start_allocations,
+        .ok = ok,
+    });
+}
+
+}  // namespace comb_bench
@@ -0,0 +1,117 @@
+#include <array>
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <fmt/format.h>
+#include "corpus.hpp"
+
+namespace comb_bench {
+
+namespace {
+
+auto constexpr SEED = uint64_t{0xC0FFEE};
+
+auto constexpr WORDS = std::array<std::string_view, 8>{
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+};
+
+auto constexpr SPACES = std::array<std::string_view, 3>{"", " ", "  "};
+
+}  // namespace
+
+auto generate_json(size_t size) -> std::string {
+    auto random = std::mt19937_64{SEED};
+    auto result = std::string{"[\n"};
+    auto out = std::back_inserter(result);
+    auto id = size_t{0};
+
+    while (result.size() < size) {
+        if (0 != id) {
+            result += ",\n";
+        }
+
+        fmt::format_to(
+            out,
+            "    {{\n"
+            "        \"id\": {},\n"
+            "        \"name\": \"{}_{}\",\n"
+            "        \"active\": {},\n"
+            "        \"balance\": {},\n"
+            "        \"tags\": [\"{}\", \"{}\", \"{}\"],\n"
+            "        \"scores\": [{}, {}, {}, {}],\n"
+            "        \"location\": {{ \"x\": {}, \"y\": {} }}\n"
+            "    }}",
+            id, WORDS[random() % WORDS.size()], id, 0 == random() % 2,
+            (int64_t) (random() % 2'000'000) - 1'000'000,
+            WORDS[random() % WORDS.size()], WORDS[random() % WORDS.size()],
+            WORDS[random() % WORDS.size()], random() % 100, random() % 100,
+            random() % 100, random() % 100, random() % 10'000,
+            random() % 10'000
+        );
+
+        id += 1;
+    }
+
+    result += "\n]\n";
+
+    return result;
+}
+
+auto generate_numbers(size_t size) -> std::string {
+    auto random = std::mt19937_64{SEED};
+    auto distribution = std::uniform_real_distribution<double>{-1e6, 1e6};
+    auto result = std::string{};
+    auto out = std::back_inserter(result);
+    auto n_numbers = size_t{0};
+
+    while (result.size() < size) {
+        if (0 != n_numbers) {
+            result += 0 == n_numbers % 16 ? '\n' : ' ';
+        }
+
+        fmt::format_to(out, "{:.6f}", distribution(random));
+        n_numbers += 1;
+    }
+
+    return result;
+}
+
+auto generate_key_values(size_t size) -> std::string {
+    auto random = std::mt19937_64{SEED};
+    auto result = std::string{};
+    auto out = std::back_inserter(result);
+
+    while (result.size() < size) {
+        fmt::format_to(
+            out, "name{}={}'{} {} {}'\n", SPACES[random() % SPACES.size()],
+            SPACES[random() % SPACES.size()], WORDS[random() % WORDS.size()],
+            random(), WORDS[random() % WORDS.size()]
+        );
+    }
+
+    return result;
+}
+
+auto read_file(char const* path) -> std::optional<std::string> {
+    auto file = std::fopen(path, "rb");
+
+    if (nullptr == file) {
+        return std::nullopt;
+    }
+
+    auto result = std::string{};
+    auto buffer = std::array<char, 1 << 16>{};
+
+    for (auto n_read = std::fread(buffer.data(), 1, buffer.size(), file);
+         0 != n_read;
+         n_read = std::fread(buffer.data(), 1, buffer.size(), file))
+    {
+        result.append(buffer.data(), n_read);
+    }
+
+    std::fclose(file);
+
+    return result;
+}
+
+}  // namespace comb_bench
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace comb_bench {
+
+// Pretty-printed JSON array of records, roughly `size` bytes long.
+auto generate_json(size_t size) -> std::string;
+
+// Floating point numbers separated by spaces and newlines.
+auto generate_numbers(size_t size) -> std::string;
+
+// Log lines in the README key-value format: `name = 'value'`.
+auto generate_key_values(size_t size) -> std::string;
+
+auto read_file(char const* path) -> std::optional<std::string>;
+
+}  // namespace comb_bench
@@ -0,0 +1,324 @@
+#include <cstdlib>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <comb/parallel.hpp>
+#include <comb/parse.hpp>
+#include "../tests/json.hpp"
+#include "bench.hpp"
+#include "corpus.hpp"
+
+using namespace comb;
+using namespace comb_bench;
+
+namespace {
+
+struct Corpus {
+    std::string name;
+    std::string text;
+};
+
+auto bench_json(Corpus const& corpus, BenchOptions options) -> void {
+    run_bench(
+        fmt::format("json/{}", corpus.name), corpus.text, options,
+        [](std::string_view src) {
+            auto result = json::parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+
+    run_bench(
+        fmt::format("json_validate/{}", corpus.name), corpus.text, options,
+        [](std::string_view src) { return json::validate(src); }
+    );
+
+    // counts values, the cheapest possible consumer of the events
+    struct Counter {
+        size_t n_values = 0;
+
+        auto on_null() -> void {
+            this->n_values += 1;
+        }
+
+        auto on_bool(bool) -> void {
+            this->n_values += 1;
+        }
+
+        auto on_integer(int64_t) -> void {
+            this->n_values += 1;
+        }
+
+        auto on_float(double) -> void {
+            this->n_values += 1;
+        }
+
+        auto on_string(EscapedString) -> void {
+            this->n_values += 1;
+        }
+
+        auto on_key(EscapedString) -> void {}
+
+        auto on_list_begin() -> void {}
+
+        auto on_list_end(size_t) -> void {}
+
+        auto on_object_begin() -> void {}
+
+        auto on_object_end(size_t) -> void {}
+    };
+
+    run_bench(
+        fmt::format("json_events/{}", corpus.name), corpus.text, options,
+        [](std::string_view src) {
+            auto counter = Counter{};
+            auto result = json::parse_events(src, counter);
+            do_not_optimize(counter.n_values);
+            return result.ok() && result.tail.empty();
+        }
+    );
+
+    // the tape keeps its storage between runs
+    auto tape = json::Tape{};
+
+    run_bench(
+        fmt::format("json_tape/{}", corpus.name), corpus.text, options,
+        [&tape](std::string_view src) {
+            auto result = json::parse_tape(src, tape);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+}
+
+auto bench_numbers(Corpus const& corpus, BenchOptions options) -> void {
+    auto parser = list(floating(), whitespace());
+
+    run_bench(
+        fmt::format("floating_list/{}", corpus.name), corpus.text, options,
+        [&parser](std::string_view src) {
+            auto result = parser.parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+}
+
+// same grammar with the element parser behind `AnyParser`, one indirect
+// call per number
+auto bench_numbers_erased(Corpus const& corpus, BenchOptions options)
+    -> void {
+    auto parser = list(erase(floating()), whitespace());
+
+    run_bench(
+        fmt::format("floating_list_erased/{}", corpus.name), corpus.text,
+        options,
+        [&parser](std::string_view src) {
+            auto result = parser.parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+}
+
+auto bench_numbers_arena(Corpus const& corpus, BenchOptions options) -> void {
+    auto arena = std::pmr::monotonic_buffer_resource{};
+    auto parser = list(
+        floating(), whitespace(), TrailingSeparator::Allowed, 0, &arena
+    );
+
+    run_bench(
+        fmt::format("floating_list_arena/{}", corpus.name), corpus.text,
+        options,
+        [&parser, &arena](std::string_view src) {
+            auto const ok = [&] {
+                auto result = parser.parse(src);
+                do_not_optimize(result);
+                return result.ok() && result.tail.empty();
+            }();
+
+            arena.release();
+
+            return ok;
+        }
+    );
+}
+
+auto bench_key_values(Corpus const& corpus, BenchOptions options) -> void {
+    auto parser = list(
+        prefix("name")
+            >> whitespace()
+            >> character('=')
+            >> whitespace()
+            >> quoted_string('\''),
+        newline(),
+        TrailingSeparator::Allowed,
+        1
+    );
+
+    run_bench(
+        fmt::format("key_value/{}", corpus.name), corpus.text, options,
+        [&parser](std::string_view src) {
+            auto result = parser.parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+
+    // the same record as one flat sequence
+    auto seq_parser = list(
+        seq<4>(
+            prefix("name"), whitespace(), character('='), whitespace(),
+            quoted_string('\'')
+        ),
+        newline(),
+        TrailingSeparator::Allowed,
+        1
+    );
+
+    run_bench(
+        fmt::format("key_value_seq/{}", corpus.name), corpus.text, options,
+        [&seq_parser](std::string_view src) {
+            auto result = seq_parser.parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+
+    // every step of the record behind `AnyParser`
+    auto erased_parser = list(
+        erase(prefix("name"))
+            >> erase(whitespace())
+            >> erase(character('='))
+            >> erase(whitespace())
+            >> erase(quoted_string('\'')),
+        erase(newline()),
+        TrailingSeparator::Allowed,
+        1
+    );
+
+    run_bench(
+        fmt::format("key_value_erased/{}", corpus.name), corpus.text, options,
+        [&erased_parser](std::string_view src) {
+            auto result = erased_parser.parse(src);
+            do_not_optimize(result);
+            return result.ok() && result.tail.empty();
+        }
+    );
+
+    // scaling over the number of chunks parsed at once
+    auto const n_threads = ThreadPool::shared().n_threads();
+
+    for (auto max_chunks = size_t{1};; max_chunks *= 2) {
+        max_chunks = std::min(max_chunks, n_threads);
+
+        auto parallel_parser = parallel_repeat(
+            prefix("name")
+                >> whitespace()
+                >> character('=')
+                >> whitespace()
+                >> quoted_string('\''),
+            '\n', max_chunks
+        );
+
+        run_bench(
+            fmt::format("key_value_parallel/{}/{}", corpus.name, max_chunks),
+            corpus.text, options,
+            [&parallel_parser](std::string_view src) {
+                auto result = parallel_parser.parse(src);
+                do_not_optimize(result);
+                return result.ok() && result.tail.empty();
+            }
+        );
+
+        if (max_chunks == n_threads) {
+            break;
+        }
+    }
+}
+
+auto print_usage(char const* program) -> void {
+    fmt::print(
+        stderr,
+        "usage: {} [--size MB] [--min-time SECONDS] [--filter SUBSTRING] "
+        "[json=PATH] [numbers=PATH] [kv=PATH]...\n",
+        program
+    );
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    auto options = BenchOptions{};
+    auto size = size_t{16} << 20;
+    auto json_corpora = std::vector<Corpus>{};
+    auto number_corpora = std::vector<Corpus>{};
+    auto key_value_corpora = std::vector<Corpus>{};
+
+    for (auto i = 1; i < argc; ++i) {
+        auto const arg = std::string_view{argv[i]};
+        auto const has_value = i + 1 < argc;
+
+        if ("--size" == arg && has_value) {
+            size = (size_t) (std::atof(argv[++i]) * (1 << 20));
+        } else if ("--min-time" == arg && has_value) {
+            options.min_seconds = std::atof(argv[++i]);
+        } else if ("--filter" == arg && has_value) {
+            options.filter = argv[++i];
+        } else if (auto const eq = arg.find('='); eq != arg.npos) {
+            auto const kind = arg.substr(0, eq);
+            auto const path = argv[i] + eq + 1;
+            auto text = read_file(path);
+
+            if (!text.has_value()) {
+                fmt::print(stderr, "failed to read '{}'\n", path);
+                return EXIT_FAILURE;
+            }
+
+            auto corpus = Corpus{.name = path, .text = std::move(*text)};
+
+            if ("json" == kind) {
+                json_corpora.push_back(std::move(corpus));
+            } else if ("numbers" == kind) {
+                number_corpora.push_back(std::move(corpus));
+            } else if ("kv" == kind) {
+                key_value_corpora.push_back(std::move(corpus));
+            } else {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    json_corpora.insert(
+        json_corpora.begin(),
+        Corpus{.name = "generated", .text = generate_json(size)}
+    );
+    number_corpora.insert(
+        number_corpora.begin(),
+        Corpus{.name = "generated", .text = generate_numbers(size)}
+    );
+    key_value_corpora.insert(
+        key_value_corpora.begin(),
+        Corpus{.name = "generated", .text = generate_key_values(size)}
+    );
+
+    print_header();
+
+    for (auto const& corpus : json_corpora) {
+        bench_json(corpus, options);
+    }
+
+    for (auto const& corpus : number_corpora) {
+        bench_numbers(corpus, options);
+        bench_numbers_erased(corpus, options);
+        bench_numbers_arena(corpus, options);
+    }
+
+    for (auto const& corpus : key_value_corpora) {
+        bench_key_values(corpus, options);
+    }
+}
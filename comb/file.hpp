@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "parse.hpp"
+
+#if !defined(COMB_NO_MMAP) && __has_include(<sys/mman.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace comb {
+
+// Read-only contents of a file. Regular files are memory-mapped, so views
+// into `view()` point straight into the page cache; other files (pipes,
+// systems without mmap) are read into an owned buffer. Views stay valid
+// while the `MappedInput` is alive, including after it is moved.
+class MappedInput {
+public:
+    static auto open(std::filesystem::path const& path)
+        -> std::optional<MappedInput> {
+#if !defined(COMB_NO_MMAP) && __has_include(<sys/mman.h>)
+        auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0) {
+            return std::nullopt;
+        }
+
+        struct stat info;
+
+        if (0 != ::fstat(fd, &info) || !S_ISREG(info.st_mode)) {
+            ::close(fd);
+            return MappedInput::read(path);
+        }
+
+        auto const size = (size_t) info.st_size;
+
+        // empty files can not be mapped and some special files report
+        // zero size, so read them instead
+        if (0 == size) {
+            ::close(fd);
+            return MappedInput::read(path);
+        }
+
+        auto const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (MAP_FAILED == data) {
+            return MappedInput::read(path);
+        }
+
+        ::madvise(data, size, MADV_SEQUENTIAL);
+#    ifdef MADV_HUGEPAGE
+        ::madvise(data, size, MADV_HUGEPAGE);
+#    endif
+
+        auto result = MappedInput{};
+        result.data = (char const*) data;
+        result.size = size;
+        result.mapped = true;
+
+        return result;
+#else
+        return MappedInput::read(path);
+#endif
+    }
+
+    MappedInput(MappedInput&& other) noexcept
+        : data{std::exchange(other.data, nullptr)}
+        , size{std::exchange(other.size, 0)}
+        , mapped{std::exchange(other.mapped, false)}
+        , storage{std::move(other.storage)} {}
+
+    auto operator=(MappedInput&& other) noexcept -> MappedInput& {
+        auto moved = std::move(other);
+
+        std::swap(this->data, moved.data);
+        std::swap(this->size, moved.size);
+        std::swap(this->mapped, moved.mapped);
+        std::swap(this->storage, moved.storage);
+
+        return *this;
+    }
+
+    ~MappedInput() {
+#if !defined(COMB_NO_MMAP) && __has_include(<sys/mman.h>)
+        if (this->mapped) {
+            ::munmap((void*) this->data, this->size);
+        }
+#endif
+    }
+
+    auto view(this MappedInput const& self) -> std::string_view {
+        return std::string_view{self.data, self.size};
+    }
+
+    auto is_mapped(this MappedInput const& self) -> bool {
+        return self.mapped;
+    }
+
+private:
+    MappedInput() = default;
+
+    static auto read(std::filesystem::path const& path)
+        -> std::optional<MappedInput> {
+        auto const file = std::fopen(path.string().c_str(), "rb");
+
+        if (nullptr == file) {
+            return std::nullopt;
+        }
+
+        auto result = MappedInput{};
+        auto size = size_t{0};
+
+        while (true) {
+            if (result.storage.size() == size) {
+                result.storage.resize(std::max(size * 2, size_t{1} << 16));
+            }
+
+            auto const n_read = std::fread(
+                result.storage.data() + size, 1, result.storage.size() - size,
+                file
+            );
+
+            if (0 == n_read) {
+                break;
+            }
+
+            size += n_read;
+        }
+
+        auto const failed = 0 != std::ferror(file);
+        std::fclose(file);
+
+        if (failed) {
+            return std::nullopt;
+        }
+
+        result.data = result.storage.data();
+        result.size = size;
+
+        return result;
+    }
+
+    char const* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::vector<char> storage{};
+};
+
+// Parse result along with the file it borrows from
+template <class T>
+struct ParsedFile {
+    MappedInput input;
+    ParseResult<T> result;
+};
+
+// Parses the whole contents of the file at `path`, `std::nullopt` if the file
+// can not be read
+inline auto parse_file(
+    std::filesystem::path const& path, ParserLike auto parser
+) -> std::optional<ParsedFile<typename decltype(parser)::ParseValue>> {
+    auto input = MappedInput::open(path);
+
+    if (!input.has_value()) {
+        return std::nullopt;
+    }
+
+    auto result = parser.parse(input->view());
+
+    return ParsedFile<typename decltype(parser)::ParseValue>{
+        .input = std::move(*input),
+        .result = std::move(result),
+    };
+}
+
+}  // namespace comb
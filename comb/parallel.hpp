@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "parse.hpp"
+
+namespace comb {
+
+// Fixed set of worker threads running batches of tasks. The thread calling
+// `run` works on its batch too, so a task may call `run` itself.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t n_workers) {
+        this->workers.reserve(n_workers);
+
+        for (auto i = size_t{0}; i < n_workers; ++i) {
+            this->workers.emplace_back([this](std::stop_token stop) {
+                this->work(stop);
+            });
+        }
+    }
+
+    ThreadPool(ThreadPool const&) = delete;
+    auto operator=(ThreadPool const&) -> ThreadPool& = delete;
+
+    // Process-wide pool with a worker per core besides the calling thread
+    static auto shared() -> ThreadPool& {
+        static auto pool =
+            ThreadPool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+
+        return pool;
+    }
+
+    // Number of threads running a batch, the calling one included
+    auto n_threads(this ThreadPool const& self) -> size_t {
+        return self.workers.size() + 1;
+    }
+
+    // Calls `task(i)` for every `i` below `n_tasks` and returns once all of
+    // the calls returned. If a call throws, the first exception is rethrown
+    // here after the others finished.
+    template <class F>
+    auto run(this ThreadPool& self, size_t n_tasks, F&& task) -> void {
+        if (0 == n_tasks) {
+            return;
+        }
+
+        auto batch = Batch{
+            .call =
+                [](void* context, size_t index) {
+                    (*static_cast<std::remove_reference_t<F>*>(context))(index);
+                },
+            .context = (void*) std::addressof(task),
+            .n_tasks = n_tasks,
+        };
+
+        auto lock = std::unique_lock{self.mutex};
+
+        self.batches.push_back(&batch);
+        self.has_work.notify_all();
+
+        while (batch.n_claimed < batch.n_tasks) {
+            self.execute(lock, batch);
+        }
+
+        self.done.wait(lock, [&batch] {
+            return batch.n_done == batch.n_tasks;
+        });
+
+#ifdef __cpp_exceptions
+        if (nullptr != batch.error) {
+            std::rethrow_exception(batch.error);
+        }
+#endif
+    }
+
+private:
+    struct Batch {
+        void (*call)(void* context, size_t index);
+        void* context;
+        size_t n_tasks;
+        size_t n_claimed = 0;
+        size_t n_done = 0;
+#ifdef __cpp_exceptions
+        // first exception thrown by a task
+        std::exception_ptr error = nullptr;
+#endif
+    };
+
+    // Runs the next task of `batch` with `lock` released
+    auto execute(
+        this ThreadPool& self, std::unique_lock<std::mutex>& lock, Batch& batch
+    ) -> void {
+        auto const index = batch.n_claimed++;
+
+        if (batch.n_claimed == batch.n_tasks) {
+            std::erase(self.batches, &batch);
+        }
+
+        lock.unlock();
+
+#ifdef __cpp_exceptions
+        try {
+            batch.call(batch.context, index);
+        } catch (...) {
+            lock.lock();
+
+            if (nullptr == batch.error) {
+                batch.error = std::current_exception();
+            }
+
+            lock.unlock();
+        }
+#else
+        batch.call(batch.context, index);
+#endif
+
+        lock.lock();
+
+        if (++batch.n_done == batch.n_tasks) {
+            self.done.notify_all();
+        }
+    }
+
+    auto work(this ThreadPool& self, std::stop_token stop) -> void {
+        auto lock = std::unique_lock{self.mutex};
+
+        while (self.has_work.wait(lock, stop, [&self] {
+            return !self.batches.empty();
+        }))
+        {
+            self.execute(lock, *self.batches.front());
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable_any has_work;
+    std::condition_variable_any done;
+    // batches with unclaimed tasks
+    std::deque<Batch*> batches;
+    // declared last to stop before the state they use is destroyed
+    std::vector<std::jthread> workers;
+};
+
+namespace basic {
+    // Parses records separated by `delimiter` like `list(record_parser,
+    // character(delimiter))` on `ThreadPool::shared()`. The input is split
+    // after delimiters into at most `max_chunks` chunks (one per pool thread
+    // if 0) and each chunk is a single task, so no more than `max_chunks`
+    // threads parse it at once. The delimiter must not occur inside records.
+    // The tail of the result is a suffix of the input.
+    template <class Char>
+    auto parallel_repeat(
+        BasicParserLike<Char> auto record_parser, Char delimiter,
+        size_t max_chunks = 0
+    ) -> BasicParserLike<Char> auto {
+        using Value = typename decltype(record_parser)::ParseValue;
+        using Result = BasicParseResult<std::vector<Value>, Char>;
+
+        // smaller chunks are not worth a thread
+        static constexpr size_t MIN_CHUNK_SIZE = size_t{1} << 16;
+
+        if (0 == max_chunks) {
+            max_chunks = ThreadPool::shared().n_threads();
+        }
+
+        auto records = List<Char>::list(
+            std::move(record_parser), character<Char>(delimiter)
+        );
+
+        auto parse = [records = std::move(records), delimiter, max_chunks](
+                         std::basic_string_view<Char> src,
+                         std::same_as<Track> auto... mode
+                     ) -> Result {
+            // workers have no error tracker, failures are parsed again on
+            // this thread to report them
+            auto const is_tracking = 0 != sizeof...(mode) &&
+                                     nullptr != ErrorTracker<Char>::installed();
+
+            auto const n_chunks = std::clamp(
+                src.size() / MIN_CHUNK_SIZE, size_t{1}, max_chunks
+            );
+
+            auto chunks = std::vector<std::basic_string_view<Char>>{};
+            chunks.reserve(n_chunks);
+
+            for (auto begin = size_t{0}; begin < src.size();) {
+                auto const target =
+                    src.size() / n_chunks * (chunks.size() + 1);
+                auto end = src.size();
+
+                if (chunks.size() + 1 < n_chunks) {
+                    end = src.find(delimiter, std::max(begin, target));
+                    end = std::basic_string_view<Char>::npos == end
+                              ? src.size()
+                              : end + 1;
+                }
+
+                chunks.push_back(src.substr(begin, end - begin));
+                begin = end;
+            }
+
+            if (chunks.empty()) {
+                return records.parse_as(src, mode...);
+            }
+
+            auto results = std::vector<Result>(chunks.size());
+
+            ThreadPool::shared().run(chunks.size(), [&](size_t i) {
+                results[i] = records.parse(chunks[i]);
+            });
+
+            auto n_values = size_t{0};
+
+            for (auto const& result : results) {
+                n_values += result.ok() ? result.value->size() : 0;
+            }
+
+            auto values = std::vector<Value>{};
+            values.reserve(n_values);
+
+            for (auto i = size_t{0}; i < chunks.size(); ++i) {
+                // a record failed past an `expect` point, it is parsed again
+                // from a suffix of the input to report its global offset
+                if (!results[i].ok()) {
+                    if (is_tracking) {
+                        auto const chunk_begin =
+                            (size_t) (chunks[i].data() - src.data());
+
+                        (void) records.parse_as(
+                            src.substr(chunk_begin), mode...
+                        );
+                    }
+
+                    return Result{
+                        .value = std::nullopt,
+                        .tail = src,
+                        .committed = true,
+                    };
+                }
+
+                std::ranges::move(
+                    *results[i].value, std::back_inserter(values)
+                );
+
+                if (results[i].tail.empty()) {
+                    continue;
+                }
+
+                auto const offset =
+                    (size_t) (results[i].tail.data() - src.data());
+
+                // the failing record is parsed with its global offset
+                if (is_tracking) {
+                    auto const chunk_begin =
+                        (size_t) (chunks[i].data() - src.data());
+                    auto const delimiter_offset =
+                        src.substr(0, offset).rfind(delimiter);
+                    auto record_begin = chunk_begin;
+
+                    if (std::basic_string_view<Char>::npos !=
+                            delimiter_offset &&
+                        delimiter_offset >= chunk_begin)
+                    {
+                        record_begin = delimiter_offset + 1;
+                    }
+
+                    (void) records.parse_as(src.substr(record_begin), mode...);
+                }
+
+                return Result{
+                    .value = std::move(values),
+                    .tail = src.substr(offset),
+                };
+            }
+
+            return Result{
+                .value = std::move(values),
+                .tail = src.substr(src.size()),
+            };
+        };
+
+        return BasicParser<decltype(parse), Char>{std::move(parse)};
+    }
+}  // namespace basic
+
+inline auto parallel_repeat(
+    ParserLike auto record_parser, char delimiter = '\n', size_t max_chunks = 0
+) -> ParserLike auto {
+    return basic::parallel_repeat<char>(
+        std::move(record_parser), delimiter, max_chunks
+    );
+}
+
+}  // namespace comb
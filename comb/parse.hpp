@@ -1,12 +1,31 @@
 #pragma once
 
 #include <string_view>
+#include <string>
+#include <algorithm>
 #include <optional>
 #include <vector>
+#include <memory_resource>
+#include <unordered_map>
+#include <atomic>
+#include <functional>
+#include <tuple>
+#include <memory>
 #include <cstdint>
-#include <cerrno>
-#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <concepts>
+#include <charconv>
+#include <array>
+#include <cmath>
 #include <type_traits>
+#include <utility>
+#include <variant>
+#include <bit>
+
+#if !defined(COMB_NO_SIMD) && defined(__SSE2__)
+#    include <immintrin.h>
+#endif
 
 namespace comb {
 
@@ -14,6 +33,8 @@ template <class T, class Char>
 struct BasicParseResult {
     std::optional<T> value;
     std::basic_string_view<Char> tail;
+    // failure past an `expect` point, enclosing alternatives are not tried
+    bool committed = false;
 
     inline auto constexpr ok(this BasicParseResult const& self) -> bool {
         return self.value.has_value();
@@ -27,7 +48,7 @@ struct BasicParseResult {
     friend inline auto constexpr operator|(
         BasicParseResult&& lhs, BasicParseResult&& rhs
     ) -> BasicParseResult {
-        if (lhs.ok()) {
+        if (lhs.ok() || lhs.committed) {
             return std::move(lhs);
         } else {
             return std::move(rhs);
@@ -38,6 +59,15 @@ struct BasicParseResult {
 template <class T>
 using ParseResult = BasicParseResult<T, char>;
 
+// Number of consecutive matches and the tail after the last one
+template <class Char>
+struct BasicMatchCount {
+    size_t n_matches;
+    std::basic_string_view<Char> tail;
+    // the match following the last one failed past an `expect` point
+    bool committed = false;
+};
+
 template <class T, class Char>
 concept BasicParseFunction =
     requires(T parse, std::basic_string_view<Char> src) {
@@ -70,6 +100,13 @@ concept ParserLike = BasicParserLike<T, char>;
 template <class T>
 concept NotVoid = !std::same_as<T, void>;
 
+template <class T>
+concept AllocatorLike = requires { typename T::value_type; };
+
+template <class Allocator, class T>
+using ReboundAllocator =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
 template <class T, class Input, class Char>
 concept BasicTransformMap = requires(T transform, Input input) {
     {
@@ -90,6 +127,210 @@ concept BasicFilterPredicate = requires(T predicate, Input input) {
 template <class T, class Input>
 concept FilterPredicate = BasicFilterPredicate<T, Input, char>;
 
+namespace basic {
+    template <class Char>
+    struct Memoize;
+}  // namespace basic
+
+// Tag selecting the value-free overload of a parse function. Parse
+// functions of the library's combinators take it as an optional second
+// argument and then return a `BasicMatch` without building their values,
+// see `BasicParser::match`.
+struct Recognize {};
+
+// Tag making leaf parsers report their failures to the installed
+// `ErrorTracker`, passed by `FurthestFailure`. Combinators forward it after
+// a `Recognize` tag, parse functions without it, e.g. user lambdas, do not
+// report. Parses without the tag compile to code without any reporting.
+struct Track {};
+
+template <class T>
+concept ParseMode = std::same_as<T, Recognize> || std::same_as<T, Track>;
+
+// Whether `Tag` is among the tags `Mode` of a parse function call
+template <class Tag, class... Mode>
+inline bool constexpr has_tag = (std::same_as<Tag, Mode> || ...);
+
+// Outcome of a parse without its value
+template <class Char>
+using BasicMatch = BasicParseResult<std::monostate, Char>;
+
+// 1-based position in the source
+struct SourceLocation {
+    size_t line;
+    size_t column;
+
+    friend auto constexpr operator==(SourceLocation, SourceLocation)
+        -> bool = default;
+};
+
+namespace basic {
+    // What a failed parser was looking for: a description like "integer"
+    // and, for literal parsers, the expected text
+    template <class Char>
+    struct Expected {
+        std::string_view name;
+        std::basic_string<Char> literal;
+
+        friend auto constexpr operator==(Expected const&, Expected const&)
+            -> bool = default;
+    };
+
+    // The failure that got furthest into the input and everything that was
+    // expected there
+    template <class Char>
+    struct ParseError {
+        size_t offset;
+        std::vector<Expected<Char>> expected;
+
+        // Line and column of the failure, `src` is the parsed input
+        auto location(
+            this ParseError const& self, std::basic_string_view<Char> src
+        ) -> SourceLocation {
+            auto const head = src.substr(0, self.offset);
+            auto const line_begin = head.rfind(Char('\n'));
+            auto const n_lines = std::ranges::count(head, Char('\n'));
+
+            return SourceLocation{
+                .line = (size_t) n_lines + 1,
+                .column = std::basic_string_view<Char>::npos == line_begin
+                              ? self.offset + 1
+                              : self.offset - line_begin,
+            };
+        }
+    };
+
+    // Collects the furthest failure while installed by
+    // `FurthestFailure::parse`. Leaf parsers report to it only when called
+    // with a `Track` tag, which `parse` passes to the parser, so parses
+    // without the tag do not touch it. Defining `COMB_NO_ERROR_TRACKING`
+    // (the CMake option of the same name) compiles reporting out even with
+    // the tag.
+    template <class Char>
+    class ErrorTracker {
+    public:
+        template <BasicParserLike<Char> P>
+        auto parse(
+            this ErrorTracker& self, P const& parser,
+            std::basic_string_view<Char> src
+        ) -> BasicParseResult<typename P::ParseValue, Char> {
+            struct ScopeGuard {
+                ErrorTracker* previous;
+
+                ~ScopeGuard() {
+                    current = previous;
+                }
+            };
+
+            self.input = src;
+            self.furthest = std::nullopt;
+            self.expected.clear();
+
+            auto const guard = ScopeGuard{std::exchange(current, &self)};
+
+            return parser.parse_as(src, Track{});
+        }
+
+        auto error(this ErrorTracker const& self)
+            -> std::optional<ParseError<Char>> {
+            if (!self.furthest.has_value()) {
+                return std::nullopt;
+            }
+
+            return ParseError<Char>{
+                .offset = *self.furthest,
+                .expected = self.expected,
+            };
+        }
+
+        // Reports that a parser expecting `name` failed at the start of
+        // `src`, if the parser was called with a `Track` tag
+        template <std::same_as<Track>... Mode>
+        static auto constexpr report(
+            std::basic_string_view<Char> src, std::string_view name,
+            std::basic_string_view<Char> literal, Mode...
+        ) -> void {
+#ifndef COMB_NO_ERROR_TRACKING
+            if constexpr (0 != sizeof...(Mode)) {
+                if !consteval {
+                    if (nullptr != current) {
+                        current->record(src, name, literal);
+                    }
+                }
+            }
+#endif
+        }
+
+        template <std::same_as<Track>... Mode>
+        static auto constexpr report(
+            std::basic_string_view<Char> src, std::string_view name,
+            Mode... mode
+        ) -> void {
+            ErrorTracker::report(
+                src, name, std::basic_string_view<Char>{}, mode...
+            );
+        }
+
+        // Tracker installed on this thread, `nullptr` if there is none or
+        // reporting is compiled out
+        static auto installed() -> ErrorTracker const* {
+#ifndef COMB_NO_ERROR_TRACKING
+            return current;
+#else
+            return nullptr;
+#endif
+        }
+
+    private:
+        static constexpr size_t MAX_EXPECTED = 16;
+
+        auto record(
+            this ErrorTracker& self, std::basic_string_view<Char> src,
+            std::string_view name, std::basic_string_view<Char> literal
+        ) -> void {
+            auto const begin = self.input.data();
+            auto const end = begin + self.input.size();
+
+            // not a suffix of the input, e.g. a nested buffer
+            if (src.data() < begin || src.data() + src.size() != end) {
+                return;
+            }
+
+            auto const offset = (size_t) (src.data() - begin);
+
+            if (self.furthest.has_value() && offset < *self.furthest) {
+                return;
+            }
+
+            if (!self.furthest.has_value() || offset > *self.furthest) {
+                self.furthest = offset;
+                self.expected.clear();
+            }
+
+            if (self.expected.size() == MAX_EXPECTED) {
+                return;
+            }
+
+            auto const is_same = [&](Expected<Char> const& expected) {
+                return expected.name == name && expected.literal == literal;
+            };
+
+            if (std::ranges::none_of(self.expected, is_same)) {
+                self.expected.push_back(Expected<Char>{
+                    .name = name,
+                    .literal = std::basic_string<Char>{literal},
+                });
+            }
+        }
+
+        inline static thread_local ErrorTracker* current = nullptr;
+
+        std::basic_string_view<Char> input;
+        std::optional<size_t> furthest;
+        std::vector<Expected<Char>> expected;
+    };
+}  // namespace basic
+
 template <class T, class Char>
     requires BasicParseFunction<T, Char>
 struct BasicParser {
@@ -101,6 +342,12 @@ struct BasicParser {
     template <class S>
     using ParserChar = BasicParser<S, Char>;
 
+    // Result of a parse function called with the tags `Mode`
+    template <class V, class... Mode>
+    using ResultFor = std::conditional_t<
+        has_tag<Recognize, Mode...>, BasicMatch<Char>,
+        BasicParseResult<V, Char>>;
+
     template <class Self>
     inline auto constexpr operator()(
         this Self&& self, std::basic_string_view<Char> src
@@ -108,19 +355,60 @@ struct BasicParser {
         return std::forward<Self>(self).parse(src);
     }
 
+    // Parses `src` without building the value if the parse function has a
+    // `Recognize` overload. Any other parse function, e.g. a user lambda, is
+    // run as usual and its value dropped, so it always sees real values.
+    template <std::same_as<Track>... Mode>
+    inline auto constexpr match(
+        this BasicParser const& self, std::basic_string_view<Char> src,
+        Mode... mode
+    ) -> BasicMatch<Char> {
+        if constexpr (requires { self.parse(src, Recognize{}, mode...); }) {
+            return self.parse(src, Recognize{}, mode...);
+        } else {
+            auto const result = self.parse_as(src, mode...);
+
+            return BasicMatch<Char>{
+                .value = result.ok() ? std::make_optional<std::monostate>()
+                                     : std::nullopt,
+                .tail = result.tail,
+                .committed = result.committed,
+            };
+        }
+    }
+
+    // `match(src)` with a `Recognize` tag, `parse(src)` otherwise. A
+    // `Track` tag is passed on if the parse function takes it.
+    template <ParseMode... Mode>
+    inline auto constexpr parse_as(
+        this BasicParser const& self, std::basic_string_view<Char> src,
+        Mode... mode
+    ) {
+        if constexpr (has_tag<Recognize, Mode...> && has_tag<Track, Mode...>) {
+            return self.match(src, Track{});
+        } else if constexpr (has_tag<Recognize, Mode...>) {
+            return self.match(src);
+        } else if constexpr (requires { self.parse(src, mode...); }) {
+            return self.parse(src, mode...);
+        } else {
+            return self.parse(src);
+        }
+    }
+
     template <BasicParseFunction<Char> S>
     friend inline auto constexpr operator|(
         BasicParser<T, Char> lhs, BasicParser<S, Char> rhs
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[lhs = std::move(lhs), rhs = std::move(rhs)](
-                              std::basic_string_view<Char> src
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
                           ) {
-            auto left_result = lhs.parse(src);
+            auto left_result = lhs.parse_as(src, mode...);
 
-            if (left_result.ok()) {
+            if (left_result.ok() || left_result.committed) {
                 return std::move(left_result);
             } else {
-                auto right_result = rhs.parse(src);
+                auto right_result = rhs.parse_as(src, mode...);
                 return std::move(right_result);
             }
         }};
@@ -131,37 +419,45 @@ struct BasicParser {
         BasicParser<T, Char> lhs, BasicParser<S, Char> rhs
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[lhs = std::move(lhs), rhs = std::move(rhs)](
-                              std::basic_string_view<Char> src
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
                           ) {
             using PairValue = std::pair<
                 typename decltype(lhs)::ParseValue,
                 typename decltype(rhs)::ParseValue>;
+            using Result = ResultFor<PairValue, decltype(mode)...>;
 
-            auto left_result = lhs.parse(src);
+            auto left_result = lhs.parse_as(src, mode...);
 
             if (!left_result.ok()) {
-                return BasicParseResult<PairValue, Char>{
+                return Result{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = left_result.committed,
                 };
             }
 
-            auto right_result = rhs.parse(left_result.tail);
+            auto right_result = rhs.parse_as(left_result.tail, mode...);
 
             if (!right_result.ok()) {
-                return BasicParseResult<PairValue, Char>{
+                return Result{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = right_result.committed,
                 };
             }
 
-            return BasicParseResult<PairValue, Char>{
-                .value = std::make_optional<PairValue>(std::make_pair(
-                    std::move(left_result).get_value(),
-                    std::move(right_result).get_value()
-                )),
-                .tail = right_result.tail,
-            };
+            if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return right_result;
+            } else {
+                return Result{
+                    .value = std::make_optional<PairValue>(std::make_pair(
+                        std::move(left_result).get_value(),
+                        std::move(right_result).get_value()
+                    )),
+                    .tail = right_result.tail,
+                };
+            }
         }};
     }
 
@@ -170,19 +466,21 @@ struct BasicParser {
         BasicParser<T, Char> lhs, BasicParser<S, Char> rhs
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[lhs = std::move(lhs), rhs = std::move(rhs)](
-                              std::basic_string_view<Char> src
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
                           ) {
             using RightValue = typename decltype(rhs)::ParseValue;
 
-            auto left_result = lhs.parse(src);
+            auto left_result = lhs.parse_as(src, mode...);
 
             if (!left_result.ok()) {
-                return BasicParseResult<RightValue, Char>{
+                return ResultFor<RightValue, decltype(mode)...>{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = left_result.committed,
                 };
             } else {
-                auto right_result = rhs.parse(left_result.tail);
+                auto right_result = rhs.parse_as(left_result.tail, mode...);
                 return std::move(right_result);
             }
         }};
@@ -192,27 +490,31 @@ struct BasicParser {
     friend inline auto constexpr operator<<(
         BasicParser<T, Char> lhs, BasicParser<S, Char> rhs
     ) -> BasicParserLike<Char> auto {
-        return ParserChar{[lhs = std::move(lhs),
-                           rhs = std::move(rhs)](std::string_view src) {
+        return ParserChar{[lhs = std::move(lhs), rhs = std::move(rhs)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
             using LeftValue = typename decltype(lhs)::ParseValue;
+            using Result = ResultFor<LeftValue, decltype(mode)...>;
 
-            auto left_result = lhs.parse(src);
+            auto left_result = lhs.parse_as(src, mode...);
 
             if (!left_result.ok()) {
                 return left_result;
             }
 
-            auto right_result = rhs.parse(left_result.tail);
+            auto right_result = rhs.parse_as(left_result.tail, mode...);
 
             if (right_result.ok()) {
-                return BasicParseResult<LeftValue, Char>{
+                return Result{
                     .value = std::move(left_result.value),
                     .tail = right_result.tail,
                 };
             } else {
-                return BasicParseResult<LeftValue, Char>{
+                return Result{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = right_result.committed,
                 };
             }
         }};
@@ -223,24 +525,32 @@ struct BasicParser {
         BasicTransformMap<ParseValue, Char> auto transform
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[self = std::move(self),
-                           transform = std::move(transform
-                           )](std::basic_string_view<Char> src) {
-            auto result = self(src);
+                           transform = std::move(transform)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            // the transform is not called without a value to transform
+            if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return self.parse_as(src, mode...);
+            } else {
+                auto result = self.parse_as(src, mode...);
 
-            using NewType = decltype(transform(result.get_value()));
+                using NewType = decltype(transform(result.get_value()));
 
-            if (result.ok()) {
-                return BasicParseResult<NewType, Char>{
-                    .value = std::make_optional<NewType>(
-                        transform(std::move(result).get_value())
-                    ),
-                    .tail = result.tail,
-                };
-            } else {
-                return BasicParseResult<NewType, Char>{
-                    .value = std::nullopt,
-                    .tail = result.tail,
-                };
+                if (result.ok()) {
+                    return BasicParseResult<NewType, Char>{
+                        .value = std::make_optional<NewType>(
+                            transform(std::move(result).get_value())
+                        ),
+                        .tail = result.tail,
+                    };
+                } else {
+                    return BasicParseResult<NewType, Char>{
+                        .value = std::nullopt,
+                        .tail = result.tail,
+                        .committed = result.committed,
+                    };
+                }
             }
         }};
     }
@@ -260,31 +570,61 @@ struct BasicParser {
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[self = std::move(self),
                            transform = std::move(transform)](
-                              std::basic_string_view<Char> src
-                          ) { return transform(self(src)); }};
+                              std::basic_string_view<Char> src,
+                              std::same_as<Track> auto... mode
+                          ) { return transform(self.parse_as(src, mode...)); }};
     }
 
     inline auto constexpr repeat(this BasicParser self, size_t min_count = 0)
         -> BasicParserLike<Char> auto {
-        return ParserChar{[self = std::move(self),
-                           min_count](std::basic_string_view<Char> src) {
-            using Sequence = std::vector<ParseValue>;
+        return std::move(self).repeat(min_count, std::allocator<ParseValue>{});
+    }
 
-            auto result_sequence = Sequence{};
-            auto tail = src;
+    // Values are allocated from `resource`
+    inline auto repeat(
+        this BasicParser self, size_t min_count,
+        std::pmr::memory_resource* resource
+    ) -> BasicParserLike<Char> auto {
+        return std::move(self).repeat(
+            min_count, std::pmr::polymorphic_allocator<ParseValue>{resource}
+        );
+    }
 
-            for (auto result = self(tail); result.ok(); result = self(tail)) {
-                result_sequence.emplace_back(std::move(result).get_value());
-                tail = result.tail;
-            }
+    // Values are stored in `std::vector` with the given allocator
+    inline auto constexpr repeat(
+        this BasicParser self, size_t min_count, AllocatorLike auto allocator
+    ) -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self), min_count, allocator](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            using Sequence = std::vector<
+                ParseValue, ReboundAllocator<decltype(allocator), ParseValue>>;
+            using Result = ResultFor<Sequence, decltype(mode)...>;
+
+            auto result_sequence =
+                Sequence(typename Sequence::allocator_type(allocator));
+
+            auto const [n_matches, tail, committed] = self.match_each(
+                src,
+                [&]([[maybe_unused]] auto&& value) {
+                    if constexpr (!has_tag<Recognize, decltype(mode)...>) {
+                        result_sequence.emplace_back(std::move(value));
+                    }
+                },
+                mode...
+            );
 
-            if (result_sequence.size() < min_count) {
-                return BasicParseResult<Sequence, Char>{
+            if (committed || n_matches < min_count) {
+                return Result{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = committed,
                 };
+            } else if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return Result{.value = std::monostate{}, .tail = tail};
             } else {
-                return BasicParseResult<Sequence, Char>{
+                return Result{
                     .value =
                         std::make_optional<Sequence>(std::move(result_sequence)
                         ),
@@ -294,18 +634,148 @@ struct BasicParser {
         }};
     }
 
+    // Folds values of repeated matches as `accumulator = op(accumulator,
+    // value)` without storing them
+    inline auto constexpr repeat_fold(
+        this BasicParser self, auto init, auto op, size_t min_count = 0
+    ) -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self), init = std::move(init),
+                           op = std::move(op), min_count](
+                              std::basic_string_view<Char> src,
+                              std::same_as<Track> auto... mode
+                          ) {
+            using Accumulator = std::remove_cvref_t<decltype(init)>;
+
+            auto accumulator = init;
+
+            auto const [n_matches, tail, committed] = self.match_each(
+                src,
+                [&](ParseValue&& value) {
+                    accumulator = op(std::move(accumulator), std::move(value));
+                },
+                mode...
+            );
+
+            if (committed || n_matches < min_count) {
+                return BasicParseResult<Accumulator, Char>{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = committed,
+                };
+            } else {
+                return BasicParseResult<Accumulator, Char>{
+                    .value = std::move(accumulator),
+                    .tail = tail,
+                };
+            }
+        }};
+    }
+
+    // Passes values of repeated matches to `sink` and returns their number.
+    // Note that `sink` sees the values even if there are less than
+    // `min_count` of them and the parser fails.
+    inline auto constexpr repeat_for_each(
+        this BasicParser self, auto sink, size_t min_count = 0
+    ) -> BasicParserLike<Char> auto {
+        return std::move(self).repeat_fold(
+            size_t{0},
+            [sink = std::move(sink)](size_t n_matches, ParseValue&& value) {
+                sink(std::move(value));
+                return n_matches + 1;
+            },
+            min_count
+        );
+    }
+
+    // Number of repeated matches
+    inline auto constexpr count(this BasicParser self, size_t min_count = 0)
+        -> BasicParserLike<Char> auto {
+        return std::move(self).repeat_fold(
+            size_t{0}, [](size_t n_matches, auto&&) { return n_matches + 1; },
+            min_count
+        );
+    }
+
+    // Source span covered by repeated matches
+    inline auto constexpr skip_many(this BasicParser self, size_t min_count = 0)
+        -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self), min_count](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            using Span = std::basic_string_view<Char>;
+            using Result = ResultFor<Span, decltype(mode)...>;
+
+            auto const [n_matches, tail, committed] =
+                self.match_each(src, [](auto&&) {}, mode...);
+
+            if (committed || n_matches < min_count) {
+                return Result{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = committed,
+                };
+            } else if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return Result{.value = std::monostate{}, .tail = tail};
+            } else {
+                return Result{
+                    .value = src.substr(0, src.size() - tail.size()),
+                    .tail = tail,
+                };
+            }
+        }};
+    }
+
+    // Passes values of consecutive matches starting at `src` to `consume`,
+    // returns the number of matches and the tail after the last one. With a
+    // `Recognize` tag the matches are parsed without values and `consume`
+    // gets an empty `std::monostate` for each.
+    template <ParseMode... Mode>
+    inline auto constexpr match_each(
+        this BasicParser const& self, std::basic_string_view<Char> src,
+        auto&& consume, Mode... mode
+    ) -> BasicMatchCount<Char> {
+        auto n_matches = size_t{0};
+        auto tail = src;
+        auto result = self.parse_as(tail, mode...);
+
+        for (; result.ok(); result = self.parse_as(tail, mode...)) {
+            consume(std::move(result).get_value());
+            tail = result.tail;
+            n_matches += 1;
+        }
+
+        return {n_matches, tail, result.committed};
+    }
+
     inline auto constexpr opt(this BasicParser self)
         -> BasicParserLike<Char> auto {
-        return ParserChar{[self = std::move(self
-                           )](std::basic_string_view<Char> src) {
-            using Value = std::optional<decltype(self(src).get_value())>;
+        return ParserChar{[self = std::move(self)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            using Value = std::optional<ParseValue>;
+            using Result = ResultFor<Value, decltype(mode)...>;
 
-            auto result = self(src);
+            auto result = self.parse_as(src, mode...);
 
-            return BasicParseResult<Value, Char>{
-                .value = std::make_optional<Value>(std::move(result).value),
-                .tail = result.tail,
-            };
+            if (result.committed) {
+                return Result{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = true,
+                };
+            }
+
+            if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return Result{.value = std::monostate{}, .tail = result.tail};
+            } else {
+                return Result{
+                    .value =
+                        std::make_optional<Value>(std::move(result).value),
+                    .tail = result.tail,
+                };
+            }
         }};
     }
 
@@ -313,15 +783,20 @@ struct BasicParser {
         -> BasicParserLike<Char> auto
         requires std::is_default_constructible_v<ParseValue>
     {
-        return ParserChar{[self = std::move(self
-                           )](std::basic_string_view<Char> src) {
-            auto result = self(src);
+        return ParserChar{[self = std::move(self)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            using Result = ResultFor<ParseValue, decltype(mode)...>;
 
-            if (result.ok()) {
+            auto result = self.parse_as(src, mode...);
+
+            if (result.ok() || result.committed) {
                 return std::move(result);
             } else {
-                return BasicParseResult<ParseValue, Char>{
-                    .value = std::make_optional<ParseValue>(),
+                // a default value, or an empty match with a `Recognize` tag
+                return Result{
+                    .value = decltype(Result::value){std::in_place},
                     .tail = src,
                 };
             }
@@ -331,29 +806,40 @@ struct BasicParser {
     inline auto constexpr opt_value(this BasicParser self, ParseValue value)
         -> BasicParserLike<Char> auto {
         return ParserChar{[self = std::move(self), value = std::move(value)](
-                              std::basic_string_view<Char> src
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
                           ) {
-            auto result = self(src);
+            auto result = self.parse_as(src, mode...);
 
-            if (result.ok()) {
+            if (result.ok() || result.committed) {
                 return std::move(result);
+            } else if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                return BasicMatch<Char>{.value = std::monostate{}, .tail = src};
             } else {
                 return BasicParseResult<ParseValue, Char>{
-                    .value = std::make_optional<ParseValue>(std::move(value)),
+                    .value = std::make_optional<ParseValue>(value),
                     .tail = src,
                 };
             }
         }};
     }
 
+    // Caches results in the installed `MemoTable`, a cache hit returns a
+    // copy of the stored value. Without a table the parser just runs.
+    inline auto memo(this BasicParser self) -> BasicParserLike<Char> auto {
+        return basic::Memoize<Char>::memoize(std::move(self));
+    }
+
     inline auto constexpr take_if(
         this BasicParser self,
         BasicFilterPredicate<ParseValue const&, Char> auto predicate
     ) -> BasicParserLike<Char> auto {
         return ParserChar{[self = std::move(self),
-                           predicate = std::move(predicate
-                           )](std::basic_string_view<Char> src) {
-            auto result = self.parse(src);
+                           predicate = std::move(predicate)](
+                              std::basic_string_view<Char> src,
+                              std::same_as<Track> auto... mode
+                          ) {
+            auto result = self.parse_as(src, mode...);
 
             if (result.ok() && predicate(result.get_value())) {
                 return std::move(result);
@@ -361,22 +847,100 @@ struct BasicParser {
                 return BasicParseResult<ParseValue, Char>{
                     .value = std::nullopt,
                     .tail = src,
+                    .committed = result.committed,
+                };
+            }
+        }};
+    }
+
+    // Source span matched by the parser. The parser is run through `match`,
+    // so vectors and mapped values of the library's combinators are not
+    // built, while user parse functions still get real values.
+    inline auto constexpr recognize(this BasicParser self)
+        -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self)](
+                              std::basic_string_view<Char> src,
+                              std::same_as<Track> auto... mode
+                          ) {
+            using Span = std::basic_string_view<Char>;
+
+            auto const result = self.match(src, mode...);
+
+            if (!result.ok()) {
+                return BasicParseResult<Span, Char>{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = result.committed,
+                };
+            } else {
+                return BasicParseResult<Span, Char>{
+                    .value = src.substr(0, src.size() - result.tail.size()),
+                    .tail = result.tail,
                 };
             }
         }};
     }
+
+    // Commits to the parser: its failure is not backtracked by enclosing
+    // alternatives, so in `character('{') >> object.expect() | value` a
+    // malformed object fails without trying `value`
+    inline auto constexpr expect(this BasicParser self)
+        -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            auto result = self.parse_as(src, mode...);
+            result.committed = !result.ok();
+
+            return result;
+        }};
+    }
+
+    // Makes a committed failure of the parser backtrackable again
+    inline auto constexpr attempt(this BasicParser self)
+        -> BasicParserLike<Char> auto {
+        return ParserChar{[self = std::move(self)](
+                              std::basic_string_view<Char> src,
+                              ParseMode auto... mode
+                          ) {
+            auto result = self.parse_as(src, mode...);
+            result.committed = false;
+
+            return result;
+        }};
+    }
 };
 
 template <class T>
 using Parser = BasicParser<T, char>;
 
+inline auto constexpr expect(ParserLike auto parser) -> ParserLike auto {
+    return std::move(parser).expect();
+}
+
+inline auto constexpr attempt(ParserLike auto parser) -> ParserLike auto {
+    return std::move(parser).attempt();
+}
+
+inline auto constexpr recognize(ParserLike auto parser) -> ParserLike auto {
+    return std::move(parser).recognize();
+}
+
 namespace basic {
     template <class Char>
     inline auto constexpr character(Char value) -> BasicParserLike<Char> auto {
         return Parser{
-            [value](std::basic_string_view<Char> src
+            [value](
+                std::basic_string_view<Char> src,
+                std::same_as<Track> auto... mode
             ) -> BasicParseResult<Char, Char> {
                 if (src.empty() || src[0] != value) {
+                    ErrorTracker<Char>::report(
+                        src, "character",
+                        std::basic_string_view<Char>{&value, 1}, mode...
+                    );
+
                     return BasicParseResult<Char, Char>{
                         .value = std::nullopt, .tail = src
                     };
@@ -395,321 +959,2634 @@ inline auto constexpr character(char value) -> ParserLike auto {
     return basic::character<char>(value);
 }
 
+namespace scan {
+    // Addressable copy of a compile-time symbol
+    template <char C>
+    inline char constexpr symbol = C;
+}  // namespace scan
+
+// Parses the symbol `C` given at compile time, e.g. `character<'{'>()`
+template <char C>
+inline auto constexpr character() -> ParserLike auto {
+    return Parser{[](std::string_view src, std::same_as<Track> auto... mode)
+                      -> ParseResult<char> {
+        if (src.empty() || C != src[0]) {
+            basic::ErrorTracker<char>::report(
+                src, "character", std::string_view{&scan::symbol<C>, 1},
+                mode...
+            );
+
+            return ParseResult<char>{.value = std::nullopt, .tail = src};
+        }
+
+        return ParseResult<char>{.value = C, .tail = src.substr(1)};
+    }};
+}
+
 // FIXME(hack3rmann): remove this definition
 inline auto constexpr is_whitespace(char value) -> bool {
     return (9 <= value && value <= 13) || 32 == value;
 }
 
-namespace basic {
-    template <class Char>
-    struct Prefix {
-        template <class T>
-        using ParserChar = BasicParser<T, Char>;
+enum class FloatFormat {
+    // `strtod`-like: optional `+`, `1.` and `.5` forms, `inf` and `nan`
+    General,
+    // strict JSON number: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    Json,
+};
 
-        inline static auto constexpr prefix(std::basic_string_view<Char> match)
-            -> BasicParserLike<Char> auto {
-            return ParserChar{
-                [match](std::basic_string_view<Char> src
-                ) -> BasicParseResult<std::basic_string_view<Char>, Char> {
-                    if (src.size() < match.size() || !src.starts_with(match)) {
-                        return BasicParseResult<
-                            std::basic_string_view<Char>, Char>{
-                            .value = std::nullopt, .tail = src
-                        };
-                    } else {
-                        auto head = src;
-                        head.remove_suffix(src.size() - match.size());
-                        src.remove_prefix(match.size());
+// Scanning kernels. SSE2/AVX2 versions are used when the target supports
+// them, define `COMB_NO_SIMD` to always use the scalar ones.
+namespace scan {
+    inline auto constexpr count_whitespace_scalar(std::string_view src)
+        -> size_t {
+        auto n_spaces = size_t{0};
 
-                        return BasicParseResult<
-                            std::basic_string_view<Char>, Char>{
-                            .value = head, .tail = src
-                        };
-                    }
-                }
-            };
+        for (auto symbol : src) {
+            if (!is_whitespace(symbol)) {
+                break;
+            }
+
+            n_spaces += 1;
         }
-    };
 
-    template <class Char>
-    auto constexpr prefix = Prefix<Char>::prefix;
-}  // namespace basic
+        return n_spaces;
+    }
 
-inline auto constexpr prefix(std::string_view match) -> ParserLike auto {
-    return basic::prefix<char>(match);
-}
+#if !defined(COMB_NO_SIMD) && defined(__SSE2__)
+    // bit `i` is set if `data[i]` is an ASCII whitespace
+    inline auto whitespace_mask16(char const* data) -> uint32_t {
+        auto const bytes = _mm_loadu_si128((__m128i const*) data);
+        auto const shifted = _mm_sub_epi8(bytes, _mm_set1_epi8(9));
+        auto const is_control = _mm_cmpeq_epi8(
+            _mm_min_epu8(shifted, _mm_set1_epi8(4)), shifted
+        );
+        auto const is_space = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
 
-inline auto constexpr integer(uint32_t radix = 10) -> ParserLike auto {
-    return Parser{[radix](std::string_view src) -> ParseResult<int64_t> {
-        errno = 0;
-        char* parse_end = nullptr;
-        auto const value = std::strtoll(src.data(), &parse_end, radix);
-        auto const parse_size = (size_t) (parse_end - src.data());
-
-        if (0 != errno || parse_size > src.size() || parse_size == 0) {
-            return ParseResult<int64_t>{.value = std::nullopt, .tail = src};
-        } else {
-            src.remove_prefix(parse_size);
-            return ParseResult<int64_t>{.value = (int64_t) value, .tail = src};
-        }
-    }};
+        return (uint32_t) _mm_movemask_epi8(_mm_or_si128(is_control, is_space));
+    }
+
+    inline auto whitespace_mask64(char const* data) -> uint64_t {
+#    if defined(__AVX2__)
+        auto const mask32 = [](char const* data) -> uint64_t {
+            auto const bytes = _mm256_loadu_si256((__m256i const*) data);
+            auto const shifted = _mm256_sub_epi8(bytes, _mm256_set1_epi8(9));
+            auto const is_control = _mm256_cmpeq_epi8(
+                _mm256_min_epu8(shifted, _mm256_set1_epi8(4)), shifted
+            );
+            auto const is_space =
+                _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' '));
+
+            return (uint32_t) _mm256_movemask_epi8(
+                _mm256_or_si256(is_control, is_space)
+            );
+        };
+
+        return mask32(data) | mask32(data + 32) << 32;
+#    else
+        return (uint64_t) whitespace_mask16(data) |
+               (uint64_t) whitespace_mask16(data + 16) << 16 |
+               (uint64_t) whitespace_mask16(data + 32) << 32 |
+               (uint64_t) whitespace_mask16(data + 48) << 48;
+#    endif
+    }
+#endif
+
+    // Number of leading ASCII whitespace symbols in `src`
+    inline auto constexpr count_whitespace(std::string_view src) -> size_t {
+#if !defined(COMB_NO_SIMD) && defined(__SSE2__)
+        if consteval {
+            return count_whitespace_scalar(src);
+        } else {
+            auto const data = src.data();
+            auto const size = src.size();
+            auto offset = size_t{0};
+
+            // most runs are empty, don't pay for a vector load then
+            if (0 == size || !is_whitespace(data[0])) {
+                return 0;
+            }
+
+            for (; offset + 64 <= size; offset += 64) {
+                if (auto const mask = whitespace_mask64(data + offset);
+                    ~mask != 0)
+                {
+                    return offset + std::countr_one(mask);
+                }
+            }
+
+            for (; offset + 16 <= size; offset += 16) {
+                if (auto const mask = whitespace_mask16(data + offset);
+                    0xFFFF != mask)
+                {
+                    return offset + std::countr_one(mask);
+                }
+            }
+
+            return offset + count_whitespace_scalar(src.substr(offset));
+        }
+#else
+        return count_whitespace_scalar(src);
+#endif
+    }
+
+    inline auto constexpr find_either_scalar(
+        std::string_view src, char first, char second
+    ) -> size_t {
+        for (auto i = size_t{0}; i < src.size(); ++i) {
+            if (first == src[i] || second == src[i]) {
+                return i;
+            }
+        }
+
+        return src.size();
+    }
+
+    // Position of the first `first` or `second` symbol in `src`,
+    // `src.size()` if there is none
+    inline auto constexpr find_either(
+        std::string_view src, char first, char second
+    ) -> size_t {
+#if !defined(COMB_NO_SIMD) && defined(__SSE2__)
+        if consteval {
+            return find_either_scalar(src, first, second);
+        } else {
+            auto const data = src.data();
+            auto const size = src.size();
+            auto offset = size_t{0};
+
+#    if defined(__AVX2__)
+            auto const firsts = _mm256_set1_epi8(first);
+            auto const seconds = _mm256_set1_epi8(second);
+
+            for (; offset + 32 <= size; offset += 32) {
+                auto const bytes =
+                    _mm256_loadu_si256((__m256i const*) (data + offset));
+                auto const mask = (uint32_t) _mm256_movemask_epi8(
+                    _mm256_or_si256(
+                        _mm256_cmpeq_epi8(bytes, firsts),
+                        _mm256_cmpeq_epi8(bytes, seconds)
+                    )
+                );
+
+                if (0 != mask) {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+#    endif
+
+            for (; offset + 16 <= size; offset += 16) {
+                auto const bytes =
+                    _mm_loadu_si128((__m128i const*) (data + offset));
+                auto const mask = (uint32_t) _mm_movemask_epi8(_mm_or_si128(
+                    _mm_cmpeq_epi8(bytes, _mm_set1_epi8(first)),
+                    _mm_cmpeq_epi8(bytes, _mm_set1_epi8(second))
+                ));
+
+                if (0 != mask) {
+                    return offset + std::countr_zero(mask);
+                }
+            }
+
+            return offset +
+                   find_either_scalar(src.substr(offset), first, second);
+        }
+#else
+        return find_either_scalar(src, first, second);
+#endif
+    }
+
+    // Value of a digit in radix up to 36, at least 36 for non-digits
+    inline auto constexpr digit_value(char symbol) -> uint32_t {
+        if ('0' <= symbol && symbol <= '9') {
+            return (uint32_t) (symbol - '0');
+        } else if ('a' <= symbol && symbol <= 'z') {
+            return (uint32_t) (symbol - 'a' + 10);
+        } else if ('A' <= symbol && symbol <= 'Z') {
+            return (uint32_t) (symbol - 'A' + 10);
+        } else {
+            return 36;
+        }
+    }
+
+    // Checks that 8 little-endian bytes are all ASCII digits
+    inline auto constexpr is_eight_digits(uint64_t chunk) -> bool {
+        return 0x3333333333333333 ==
+               ((chunk & 0xF0F0F0F0F0F0F0F0) |
+                ((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4);
+    }
+
+    // Converts 8 little-endian ASCII digits with 3 multiplications
+    inline auto constexpr parse_eight_digits(uint64_t chunk) -> uint32_t {
+        chunk = (chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+        chunk = (chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+
+        return (uint32_t) ((chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32);
+    }
+
+    struct Digits {
+        uint64_t value;
+        size_t size;
+        bool overflow;
+    };
+
+    // Parses the longest digit sequence prefix of `src` into `uint64_t`
+    inline auto constexpr parse_digits(std::string_view src, uint32_t radix)
+        -> Digits {
+        auto result = Digits{.value = 0, .size = 0, .overflow = false};
+
+        if (radix < 2 || 36 < radix) {
+            return result;
+        }
+
+        if !consteval {
+            if (10 == radix && std::endian::little == std::endian::native) {
+                // 16 digits always fit, the rest is checked one by one
+                while (result.size < 16 && result.size + 8 <= src.size()) {
+                    auto chunk = uint64_t{0};
+                    std::memcpy(&chunk, src.data() + result.size, 8);
+
+                    if (!is_eight_digits(chunk)) {
+                        break;
+                    }
+
+                    result.value =
+                        result.value * 100'000'000 + parse_eight_digits(chunk);
+                    result.size += 8;
+                }
+            }
+        }
+
+        for (; result.size < src.size(); ++result.size) {
+            auto const digit = digit_value(src[result.size]);
+
+            if (digit >= radix) {
+                break;
+            }
+
+            if (result.value >
+                (std::numeric_limits<uint64_t>::max() - digit) / radix)
+            {
+                result.overflow = true;
+                break;
+            }
+
+            result.value = result.value * radix + digit;
+        }
+
+        return result;
+    }
+
+    // Decimal number `mantissa * 10^exponent` spanning `size` chars
+    struct Decimal {
+        size_t size;
+        uint64_t mantissa;
+        int64_t exponent;
+        bool negative;
+        // more than 19 significant digits, `mantissa` is truncated
+        bool truncated;
+    };
+
+    inline auto constexpr is_digit(char symbol) -> bool {
+        return '0' <= symbol && symbol <= '9';
+    }
+
+    inline auto constexpr scan_decimal(
+        std::string_view src, FloatFormat format
+    ) -> std::optional<Decimal> {
+        auto result = Decimal{
+            .size = 0,
+            .mantissa = 0,
+            .exponent = 0,
+            .negative = false,
+            .truncated = false,
+        };
+
+        auto i = size_t{0};
+        auto n_significant = size_t{0};
+        auto const is_json = FloatFormat::Json == format;
+
+        auto const add_digit = [&](char symbol, bool is_fraction) {
+            if (0 == n_significant && '0' == symbol) {
+                result.exponent -= is_fraction ? 1 : 0;
+            } else if (n_significant < 19) {
+                result.mantissa =
+                    result.mantissa * 10 + (uint64_t) (symbol - '0');
+                result.exponent -= is_fraction ? 1 : 0;
+                n_significant += 1;
+            } else {
+                result.truncated |= '0' != symbol;
+                result.exponent += is_fraction ? 0 : 1;
+            }
+        };
+
+        if (i < src.size() && ('-' == src[i] || ('+' == src[i] && !is_json))) {
+            result.negative = '-' == src[i];
+            i += 1;
+        }
+
+        auto const integer_begin = i;
+
+        if (is_json && i < src.size() && '0' == src[i]) {
+            i += 1;
+        } else {
+            for (; i < src.size() && is_digit(src[i]); ++i) {
+                add_digit(src[i], false);
+            }
+        }
+
+        auto const n_integer_digits = i - integer_begin;
+        auto n_fraction_digits = size_t{0};
+
+        if (i < src.size() && '.' == src[i]) {
+            auto j = i + 1;
+
+            for (; j < src.size() && is_digit(src[j]); ++j) {
+                add_digit(src[j], true);
+            }
+
+            n_fraction_digits = j - i - 1;
+
+            if (0 != n_fraction_digits || (!is_json && 0 != n_integer_digits)) {
+                i = j;
+            }
+        }
+
+        if (0 == n_integer_digits && (is_json || 0 == n_fraction_digits)) {
+            return std::nullopt;
+        }
+
+        if (i < src.size() && ('e' == src[i] || 'E' == src[i])) {
+            auto j = i + 1;
+            auto negative_exponent = false;
+
+            if (j < src.size() && ('-' == src[j] || '+' == src[j])) {
+                negative_exponent = '-' == src[j];
+                j += 1;
+            }
+
+            auto const exponent_begin = j;
+            auto exponent = int64_t{0};
+
+            for (; j < src.size() && is_digit(src[j]); ++j) {
+                // anything this large is out of range anyway
+                exponent = std::min<int64_t>(
+                    exponent * 10 + (src[j] - '0'), 1'000'000
+                );
+            }
+
+            if (j != exponent_begin) {
+                result.exponent += negative_exponent ? -exponent : exponent;
+                i = j;
+            }
+        }
+
+        result.size = i;
+
+        return result;
+    }
+
+    // Exactly rounded value of `decimal` if both the mantissa and the power
+    // of ten are exact in `T`, so that one multiplication or division
+    // rounds correctly (Clinger's fast path)
+    template <std::floating_point T>
+    inline auto constexpr exact_decimal(Decimal decimal) -> std::optional<T> {
+        auto constexpr POWERS = std::array<double, 23>{
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+        };
+
+        // types wider than `double` only take the fast path for zero, so the
+        // shift is capped to stay below the width of `uint64_t`
+        auto constexpr MAX_EXACT_POWER = std::same_as<T, float> ? 10 : 22;
+        auto constexpr MAX_EXACT_MANTISSA =
+            uint64_t{1} << std::min(std::numeric_limits<T>::digits, 63);
+
+        if (decimal.truncated ||
+            (std::numeric_limits<T>::digits > 53 && 0 != decimal.mantissa) ||
+            decimal.mantissa > MAX_EXACT_MANTISSA ||
+            decimal.exponent < -MAX_EXACT_POWER ||
+            decimal.exponent > MAX_EXACT_POWER)
+        {
+            return std::nullopt;
+        }
+
+        auto value = (T) decimal.mantissa;
+        auto const power = (T) POWERS[std::abs(decimal.exponent)];
+
+        value = decimal.exponent < 0 ? value / power : value * power;
+
+        return decimal.negative ? -value : value;
+    }
+}  // namespace scan
+
+namespace basic {
+    template <class Char>
+    struct Prefix {
+        template <class T>
+        using ParserChar = BasicParser<T, Char>;
+
+        inline static auto constexpr prefix(std::basic_string_view<Char> match)
+            -> BasicParserLike<Char> auto {
+            return ParserChar{
+                [match](
+                    std::basic_string_view<Char> src,
+                    std::same_as<Track> auto... mode
+                ) -> BasicParseResult<std::basic_string_view<Char>, Char> {
+                    if (src.size() < match.size() || !src.starts_with(match)) {
+                        ErrorTracker<Char>::report(
+                            src, "prefix", match, mode...
+                        );
+
+                        return BasicParseResult<
+                            std::basic_string_view<Char>, Char>{
+                            .value = std::nullopt, .tail = src
+                        };
+                    } else {
+                        auto head = src;
+                        head.remove_suffix(src.size() - match.size());
+                        src.remove_prefix(match.size());
+
+                        return BasicParseResult<
+                            std::basic_string_view<Char>, Char>{
+                            .value = head, .tail = src
+                        };
+                    }
+                }
+            };
+        }
+    };
+
+    template <class Char>
+    auto constexpr prefix = Prefix<Char>::prefix;
+}  // namespace basic
+
+inline auto constexpr prefix(std::string_view match) -> ParserLike auto {
+    return basic::prefix<char>(match);
+}
+
+// String literal usable as a template argument, e.g. `prefix<"null">()`
+template <size_t N>
+struct FixedString {
+    char data[N];
+
+    consteval FixedString(char const (&string)[N]) {
+        std::copy_n(string, N, this->data);
+    }
+
+    static auto constexpr size() -> size_t {
+        return N - 1;
+    }
+
+    auto constexpr view(this FixedString const& self) -> std::string_view {
+        return std::string_view{self.data, N - 1};
+    }
+};
+
+// Parses the string `Match` given at compile time. Its length and contents
+// are constants, so short matches compile to a few fixed-width compares.
+template <FixedString Match>
+inline auto constexpr prefix() -> ParserLike auto {
+    return Parser{[](std::string_view src, std::same_as<Track> auto... mode)
+                      -> ParseResult<std::string_view> {
+        auto constexpr size = Match.size();
+
+        if (src.size() < size ||
+            0 != std::char_traits<char>::compare(src.data(), Match.data, size))
+        {
+            basic::ErrorTracker<char>::report(
+                src, "prefix", Match.view(), mode...
+            );
+
+            return ParseResult<std::string_view>{
+                .value = std::nullopt, .tail = src
+            };
+        }
+
+        return ParseResult<std::string_view>{
+            .value = src.substr(0, size), .tail = src.substr(size)
+        };
+    }};
+}
+
+// Parses an optionally signed integer of type `T` in the given radix (2 to
+// 36) without reading past the end of the source. Values that do not fit
+// into `T` are rejected.
+template <std::integral T = int64_t>
+    requires(!std::same_as<T, bool> && sizeof(T) <= sizeof(uint64_t))
+inline auto constexpr integer(uint32_t radix = 10) -> ParserLike auto {
+    return Parser{[radix](
+                      std::string_view src, std::same_as<Track> auto... mode
+                  ) -> ParseResult<T> {
+        auto tail = src;
+        auto negative = false;
+
+        if (!tail.empty() && ('-' == tail[0] || '+' == tail[0])) {
+            negative = '-' == tail[0];
+            tail.remove_prefix(1);
+        }
+
+        auto const digits = scan::parse_digits(tail, radix);
+        auto const max = (uint64_t) std::numeric_limits<T>::max();
+        auto const limit = negative && std::is_signed_v<T> ? max + 1 : max;
+
+        if (0 == digits.size || digits.overflow || digits.value > limit ||
+            (negative && std::is_unsigned_v<T>))
+        {
+            basic::ErrorTracker<char>::report(src, "integer", mode...);
+
+            return ParseResult<T>{.value = std::nullopt, .tail = src};
+        }
+
+        using Unsigned = std::make_unsigned_t<T>;
+
+        auto const magnitude = (Unsigned) digits.value;
+        auto const value = (T) (negative ? Unsigned{0} - magnitude : magnitude);
+
+        tail.remove_prefix(digits.size);
+
+        return ParseResult<T>{.value = value, .tail = tail};
+    }};
+}
+
+// Parses a floating point number of type `T` without reading past the end
+// of the source. Out of range values are rejected.
+template <std::floating_point T = double>
+inline auto constexpr floating(FloatFormat format = FloatFormat::General)
+    -> ParserLike auto {
+    return Parser{[format](
+                      std::string_view src, std::same_as<Track> auto... mode
+                  ) -> ParseResult<T> {
+        auto const number = scan::scan_decimal(src, format);
+        auto const from_chars_size = [&src](size_t size, T& value) -> size_t {
+            // `from_chars` rejects `+`, the sign after it must not be doubled
+            auto const skip_plus = src.size() > 1 && '+' == src[0] &&
+                                   '+' != src[1] && '-' != src[1];
+            auto const begin = src.data() + (skip_plus ? 1 : 0);
+            auto const [end, error] = std::from_chars(
+                begin, src.data() + size, value, std::chars_format::general
+            );
+
+            return std::errc{} == error ? (size_t) (end - src.data()) : 0;
+        };
+
+        auto value = T{0};
+        auto size = size_t{0};
+
+        if (!number.has_value()) {
+            // `inf` and `nan` are left to `from_chars`
+            if (FloatFormat::General == format) {
+                size = from_chars_size(src.size(), value);
+            }
+        } else if (auto const exact = scan::exact_decimal<T>(*number)) {
+            value = *exact;
+            size = number->size;
+        } else {
+            size = from_chars_size(number->size, value);
+        }
+
+        if (0 == size) {
+            basic::ErrorTracker<char>::report(src, "number", mode...);
+
+            return ParseResult<T>{.value = std::nullopt, .tail = src};
+        }
+
+        src.remove_prefix(size);
+
+        return ParseResult<T>{.value = value, .tail = src};
+    }};
+}
+
+inline auto constexpr whitespace(uint32_t min_count = 0) -> ParserLike auto {
+    return Parser{
+        [min_count](std::string_view src, std::same_as<Track> auto... mode)
+            -> ParseResult<std::string_view> {
+            auto const n_spaces = scan::count_whitespace(src);
+
+            if (n_spaces < min_count) {
+                basic::ErrorTracker<char>::report(
+                    src.substr(n_spaces), "whitespace", mode...
+                );
+
+                return ParseResult<std::string_view>{
+                    .value = std::nullopt, .tail = src
+                };
+            } else {
+                auto match = src;
+                match.remove_suffix(src.size() - n_spaces);
+                src.remove_prefix(n_spaces);
+
+                return ParseResult<std::string_view>{
+                    .value = match, .tail = src
+                };
+            }
+        }
+    };
+}
+
+// Set of symbols as a 256-bit table, e.g.
+// `CharClass::range('a', 'z') | CharClass::of("_$")`
+struct CharClass {
+    std::array<uint64_t, 4> bits{};
+
+    static auto constexpr of(std::string_view symbols) -> CharClass {
+        auto result = CharClass{};
+
+        for (auto const symbol : symbols) {
+            auto const index = (uint8_t) symbol;
+            result.bits[index / 64] |= uint64_t{1} << index % 64;
+        }
+
+        return result;
+    }
+
+    static auto constexpr range(char first, char last) -> CharClass {
+        auto result = CharClass{};
+
+        for (auto index = (uint32_t) (uint8_t) first;
+             index <= (uint32_t) (uint8_t) last; ++index)
+        {
+            result.bits[index / 64] |= uint64_t{1} << index % 64;
+        }
+
+        return result;
+    }
+
+    auto constexpr contains(this CharClass const& self, char symbol) -> bool {
+        auto const index = (uint8_t) symbol;
+        return 0 != (self.bits[index / 64] >> index % 64 & 1);
+    }
+
+    // all symbols are below 128
+    auto constexpr is_ascii(this CharClass const& self) -> bool {
+        return 0 == (self.bits[2] | self.bits[3]);
+    }
+
+    friend auto constexpr operator|(CharClass lhs, CharClass rhs)
+        -> CharClass {
+        for (auto i = size_t{0}; i < lhs.bits.size(); ++i) {
+            lhs.bits[i] |= rhs.bits[i];
+        }
+
+        return lhs;
+    }
+
+    friend auto constexpr operator&(CharClass lhs, CharClass rhs)
+        -> CharClass {
+        for (auto i = size_t{0}; i < lhs.bits.size(); ++i) {
+            lhs.bits[i] &= rhs.bits[i];
+        }
+
+        return lhs;
+    }
+
+    friend auto constexpr operator~(CharClass value) -> CharClass {
+        for (auto& word : value.bits) {
+            word = ~word;
+        }
+
+        return value;
+    }
+
+    friend auto constexpr operator==(CharClass const&, CharClass const&)
+        -> bool = default;
+};
+
+namespace char_class {
+    inline auto constexpr digit = CharClass::range('0', '9');
+    inline auto constexpr lower = CharClass::range('a', 'z');
+    inline auto constexpr upper = CharClass::range('A', 'Z');
+    inline auto constexpr alpha = lower | upper;
+    inline auto constexpr alnum = alpha | digit;
+    inline auto constexpr word = alnum | CharClass::of("_");
+    inline auto constexpr hex_digit =
+        digit | CharClass::range('a', 'f') | CharClass::range('A', 'F');
+    inline auto constexpr space = CharClass::of(" \t\n\v\f\r");
+}  // namespace char_class
+
+namespace scan {
+    inline auto constexpr count_class_scalar(
+        std::string_view src, CharClass const& symbols
+    ) -> size_t {
+        auto size = size_t{0};
+
+        while (size < src.size() && symbols.contains(src[size])) {
+            size += 1;
+        }
+
+        return size;
+    }
+
+    // Class along with the lookup table of `count_class`, built once per
+    // parser rather than on every scan. ASCII symbol `16 * h + l` is in the
+    // class if bit `h` of `low[l]` is set.
+    struct ClassTable {
+        CharClass symbols;
+        std::array<uint8_t, 16> low{};
+
+        explicit constexpr ClassTable(CharClass symbols)
+            : symbols{symbols} {
+            for (auto index = uint32_t{0}; index < 128; ++index) {
+                if (symbols.contains((char) index)) {
+                    this->low[index % 16] |= (uint8_t) (1 << index / 16);
+                }
+            }
+        }
+    };
+
+#if !defined(COMB_NO_SIMD) && defined(__SSSE3__)
+    // Nibble lookup tables of an ASCII class: symbol `16 * h + l` is in the
+    // class if `low[l] & high[h]` is not zero
+    struct ClassTables {
+        __m128i low;
+        __m128i high;
+    };
+
+    inline auto class_tables(ClassTable const& table) -> ClassTables {
+        return ClassTables{
+            .low = _mm_loadu_si128((__m128i const*) table.low.data()),
+            // high nibbles of 8 and above are never in an ASCII class
+            .high = _mm_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0
+            ),
+        };
+    }
+
+    // bit `i` is set if `data[i]` is in the class
+    inline auto class_mask16(char const* data, ClassTables const& tables)
+        -> uint32_t {
+        auto const bytes = _mm_loadu_si128((__m128i const*) data);
+        auto const nibble_mask = _mm_set1_epi8(0x0F);
+        auto const low = _mm_and_si128(bytes, nibble_mask);
+        auto const high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+        auto const matches = _mm_and_si128(
+            _mm_shuffle_epi8(tables.low, low),
+            _mm_shuffle_epi8(tables.high, high)
+        );
+
+        return 0xFFFF & ~(uint32_t) _mm_movemask_epi8(
+                            _mm_cmpeq_epi8(matches, _mm_setzero_si128())
+                        );
+    }
+#endif
+
+    // Number of leading symbols of `src` in the class
+    inline auto constexpr count_class(
+        std::string_view src, ClassTable const& table
+    ) -> size_t {
+        auto const& symbols = table.symbols;
+
+#if !defined(COMB_NO_SIMD) && defined(__SSSE3__)
+        if consteval {
+            return count_class_scalar(src, symbols);
+        } else {
+            auto const data = src.data();
+            auto const size = src.size();
+            auto offset = size_t{0};
+
+            // short runs are common, try a few symbols before the tables
+            for (; offset < std::min(size, size_t{4}); ++offset) {
+                if (!symbols.contains(data[offset])) {
+                    return offset;
+                }
+            }
+
+            if (offset + 16 > size || !symbols.is_ascii()) {
+                return offset + count_class_scalar(src.substr(offset), symbols);
+            }
+
+            auto const tables = class_tables(table);
+
+            for (; offset + 16 <= size; offset += 16) {
+                if (auto const mask = class_mask16(data + offset, tables);
+                    0xFFFF != mask)
+                {
+                    return offset + std::countr_one(mask);
+                }
+            }
+
+            return offset + count_class_scalar(src.substr(offset), symbols);
+        }
+#else
+        return count_class_scalar(src, symbols);
+#endif
+    }
+}  // namespace scan
+
+// Parses the longest run of up to `max_count` symbols of the class, failing
+// if it is shorter than `min_count`
+inline auto constexpr take_while(
+    CharClass symbols, size_t min_count = 0,
+    size_t max_count = std::string_view::npos
+) -> ParserLike auto {
+    return Parser{[table = scan::ClassTable{symbols}, min_count, max_count](
+                      std::string_view src, std::same_as<Track> auto... mode
+                  ) -> ParseResult<std::string_view> {
+        auto const size = scan::count_class(
+            src.substr(0, std::min(src.size(), max_count)), table
+        );
+
+        if (size < min_count) {
+            basic::ErrorTracker<char>::report(
+                src.substr(size), "character class", mode...
+            );
+
+            return ParseResult<std::string_view>{
+                .value = std::nullopt, .tail = src
+            };
+        }
+
+        return ParseResult<std::string_view>{
+            .value = src.substr(0, size), .tail = src.substr(size)
+        };
+    }};
+}
+
+// Parses one symbol of the class
+inline auto constexpr one_of(CharClass symbols) -> ParserLike auto {
+    return Parser{[symbols](
+                      std::string_view src, std::same_as<Track> auto... mode
+                  ) -> ParseResult<char> {
+        if (src.empty() || !symbols.contains(src[0])) {
+            basic::ErrorTracker<char>::report(src, "character class", mode...);
+
+            return ParseResult<char>{.value = std::nullopt, .tail = src};
+        }
+
+        return ParseResult<char>{.value = src[0], .tail = src.substr(1)};
+    }};
+}
+
+inline auto constexpr one_of(std::string_view symbols) -> ParserLike auto {
+    return one_of(CharClass::of(symbols));
+}
+
+// Parses one symbol not in the class
+inline auto constexpr none_of(CharClass symbols) -> ParserLike auto {
+    return one_of(~symbols);
+}
+
+inline auto constexpr none_of(std::string_view symbols) -> ParserLike auto {
+    return one_of(~CharClass::of(symbols));
+}
+
+inline auto constexpr newline() -> ParserLike auto {
+    return prefix("\r\n") | prefix("\n") | prefix("\r");
+}
+
+inline auto constexpr end() -> ParserLike auto {
+    return Parser{[](std::string_view src, std::same_as<Track> auto... mode)
+                      -> ParseResult<std::string_view> {
+        if (src.empty()) {
+            return ParseResult<std::string_view>{
+                .value = std::make_optional<std::string_view>(src),
+                .tail = src,
+            };
+        } else {
+            basic::ErrorTracker<char>::report(src, "end of input", mode...);
+
+            return ParseResult<std::string_view>{
+                .value = std::nullopt,
+                .tail = src,
+            };
+        }
+    }};
+}
+
+inline auto constexpr quoted_string(char quote_symbol = '"') -> ParserLike
+    auto {
+    return Parser{
+        [quote_symbol](std::string_view src, std::same_as<Track> auto... mode)
+            -> ParseResult<std::string_view> {
+            auto open_quote = character(quote_symbol).parse(src, mode...);
+            auto tail = open_quote.tail;
+
+            if (!open_quote.ok()) {
+                return ParseResult<std::string_view>{
+                    .value = std::nullopt, .tail = src
+                };
+            }
+
+            auto const n_string_symbols = tail.find(quote_symbol);
+
+            if (std::string_view::npos == n_string_symbols) {
+                basic::ErrorTracker<char>::report(
+                    tail.substr(tail.size()), "closing quote",
+                    std::string_view{&quote_symbol, 1}, mode...
+                );
+
+                return ParseResult<std::string_view>{
+                    .value = std::nullopt, .tail = src
+                };
+            }
+
+            auto match = tail;
+            match.remove_suffix(src.size() - 1 - n_string_symbols);
+            tail.remove_prefix(n_string_symbols + 1);
+
+            return ParseResult<std::string_view>{.value = match, .tail = tail};
+        }
+    };
+}
+
+// Contents of a quoted string with escape sequences left as is
+struct EscapedString {
+    std::string_view raw;
+    bool has_escapes;
+
+    friend auto constexpr operator==(EscapedString, EscapedString) -> bool =
+        default;
+
+    // Decodes JSON escape sequences (`\"`, `\\`, `\/`, `\b`, `\f`, `\n`,
+    // `\r`, `\t`, `\uXXXX` including surrogate pairs) and `\'` to UTF-8.
+    // Returns `raw` itself if there are no escapes, otherwise writes to
+    // `buffer` which must hold at least `raw.size()` chars.
+    inline auto unescape(this EscapedString const& self, char* buffer)
+        -> std::optional<std::string_view> {
+        if (!self.has_escapes) {
+            return self.raw;
+        }
+
+        auto const src = self.raw;
+        auto size = size_t{0};
+
+        auto const parse_hex4 =
+            [&src](size_t offset) -> std::optional<uint32_t> {
+            if (offset + 4 > src.size()) {
+                return std::nullopt;
+            }
+
+            auto value = uint32_t{0};
+
+            for (auto symbol : src.substr(offset, 4)) {
+                value <<= 4;
+
+                if ('0' <= symbol && symbol <= '9') {
+                    value |= (uint32_t) (symbol - '0');
+                } else if ('a' <= symbol && symbol <= 'f') {
+                    value |= (uint32_t) (symbol - 'a' + 10);
+                } else if ('A' <= symbol && symbol <= 'F') {
+                    value |= (uint32_t) (symbol - 'A' + 10);
+                } else {
+                    return std::nullopt;
+                }
+            }
+
+            return value;
+        };
+
+        for (auto i = size_t{0}; i < src.size();) {
+            auto const n_plain = std::min(src.find('\\', i), src.size()) - i;
+
+            std::copy_n(src.data() + i, n_plain, buffer + size);
+            size += n_plain;
+            i += n_plain;
+
+            if (i == src.size()) {
+                break;
+            }
+
+            if (i + 1 == src.size()) {
+                return std::nullopt;
+            }
+
+            auto const escaped = src[i + 1];
+            i += 2;
+
+            switch (escaped) {
+            case '"':
+            case '\'':
+            case '\\':
+            case '/':
+                buffer[size++] = escaped;
+                continue;
+            case 'b':
+                buffer[size++] = '\b';
+                continue;
+            case 'f':
+                buffer[size++] = '\f';
+                continue;
+            case 'n':
+                buffer[size++] = '\n';
+                continue;
+            case 'r':
+                buffer[size++] = '\r';
+                continue;
+            case 't':
+                buffer[size++] = '\t';
+                continue;
+            case 'u':
+                break;
+            default:
+                return std::nullopt;
+            }
+
+            auto code_point = parse_hex4(i);
+
+            if (!code_point.has_value() ||
+                (0xDC00 <= *code_point && *code_point <= 0xDFFF))
+            {
+                return std::nullopt;
+            }
+
+            i += 4;
+
+            if (0xD800 <= *code_point && *code_point <= 0xDBFF) {
+                if (i + 2 > src.size() || '\\' != src[i] || 'u' != src[i + 1])
+                {
+                    return std::nullopt;
+                }
+
+                auto const low = parse_hex4(i + 2);
+
+                if (!low.has_value() || *low < 0xDC00 || 0xDFFF < *low) {
+                    return std::nullopt;
+                }
+
+                i += 6;
+                code_point =
+                    0x10000 + ((*code_point - 0xD800) << 10) + (*low - 0xDC00);
+            }
+
+            auto const value = *code_point;
+
+            if (value < 0x80) {
+                buffer[size++] = (char) value;
+            } else if (value < 0x800) {
+                buffer[size++] = (char) (0xC0 | value >> 6);
+                buffer[size++] = (char) (0x80 | (value & 0x3F));
+            } else if (value < 0x10000) {
+                buffer[size++] = (char) (0xE0 | value >> 12);
+                buffer[size++] = (char) (0x80 | (value >> 6 & 0x3F));
+                buffer[size++] = (char) (0x80 | (value & 0x3F));
+            } else {
+                buffer[size++] = (char) (0xF0 | value >> 18);
+                buffer[size++] = (char) (0x80 | (value >> 12 & 0x3F));
+                buffer[size++] = (char) (0x80 | (value >> 6 & 0x3F));
+                buffer[size++] = (char) (0x80 | (value & 0x3F));
+            }
+        }
+
+        return std::string_view{buffer, size};
+    }
+};
+
+// Parses a quoted string where `\` escapes the next symbol. The contents are
+// not decoded, see `EscapedString::unescape`.
+inline auto constexpr escaped_string(char quote_symbol = '"') -> ParserLike
+    auto {
+    return Parser{
+        [quote_symbol](std::string_view src, std::same_as<Track> auto... mode)
+            -> ParseResult<EscapedString> {
+            if (src.empty() || quote_symbol != src[0]) {
+                basic::ErrorTracker<char>::report(
+                    src, "string", std::string_view{&quote_symbol, 1}, mode...
+                );
+
+                return ParseResult<EscapedString>{
+                    .value = std::nullopt, .tail = src
+                };
+            }
+
+            auto const tail = src.substr(1);
+            auto has_escapes = false;
+            auto size = size_t{0};
+
+            while (true) {
+                size += scan::find_either(
+                    tail.substr(size), quote_symbol, '\\'
+                );
+
+                if (size + 1 > tail.size() ||
+                    ('\\' == tail[size] && size + 2 > tail.size()))
+                {
+                    basic::ErrorTracker<char>::report(
+                        tail.substr(tail.size()), "closing quote",
+                        std::string_view{&quote_symbol, 1}, mode...
+                    );
+
+                    return ParseResult<EscapedString>{
+                        .value = std::nullopt, .tail = src
+                    };
+                }
+
+                if (quote_symbol == tail[size]) {
+                    break;
+                }
+
+                has_escapes = true;
+                size += 2;
+            }
+
+            return ParseResult<EscapedString>{
+                .value =
+                    EscapedString{
+                        .raw = tail.substr(0, size),
+                        .has_escapes = has_escapes,
+                    },
+                .tail = tail.substr(size + 1),
+            };
+        }
+    };
+}
+
+template <class V>
+struct Keyword {
+    std::string_view name;
+    V value;
+};
+
+namespace scan {
+    // Keywords bucketed by their first symbol, longest first in each bucket.
+    // Equal keywords keep their given order, so the first of them is found.
+    template <class V, size_t N>
+    struct KeywordTable {
+        std::array<Keyword<V>, N> keywords;
+        std::array<size_t, 257> bucket_begin;
+        std::optional<size_t> empty_index;
+
+        constexpr explicit KeywordTable(Keyword<V> const (&entries)[N])
+        : keywords{std::to_array(entries)}
+        , bucket_begin{}
+        , empty_index{} {
+            auto const is_before = [](Keyword<V> const& lhs,
+                                      Keyword<V> const& rhs) {
+                if (lhs.name.empty() || rhs.name.empty()) {
+                    return !lhs.name.empty() && rhs.name.empty();
+                } else if (lhs.name[0] != rhs.name[0]) {
+                    return (unsigned char) lhs.name[0] <
+                           (unsigned char) rhs.name[0];
+                } else {
+                    return lhs.name.size() > rhs.name.size();
+                }
+            };
+
+            // stable insertion sort, `std::stable_sort` is not `constexpr`
+            for (auto it = this->keywords.begin(); it != this->keywords.end();
+                 ++it)
+            {
+                auto const position = std::upper_bound(
+                    this->keywords.begin(), it, *it, is_before
+                );
+
+                std::rotate(position, it, it + 1);
+            }
+
+            auto index = size_t{0};
+
+            for (auto symbol = size_t{0}; symbol < 256; ++symbol) {
+                this->bucket_begin[symbol] = index;
+
+                while (index < N && !this->keywords[index].name.empty() &&
+                       (unsigned char) this->keywords[index].name[0] == symbol)
+                {
+                    index += 1;
+                }
+            }
+
+            this->bucket_begin[256] = index;
+
+            if (index < N) {
+                this->empty_index = index;
+            }
+        }
+
+        inline auto constexpr find(std::string_view src) const
+            -> Keyword<V> const* {
+            if (!src.empty()) {
+                auto const symbol = (unsigned char) src[0];
+                auto const end = this->bucket_begin[symbol + 1];
+
+                for (auto i = this->bucket_begin[symbol]; i < end; ++i) {
+                    if (src.substr(1).starts_with(
+                            this->keywords[i].name.substr(1)
+                        ))
+                    {
+                        return &this->keywords[i];
+                    }
+                }
+            }
+
+            if (this->empty_index.has_value()) {
+                return &this->keywords[*this->empty_index];
+            }
+
+            return nullptr;
+        }
+    };
+}  // namespace scan
+
+// Matches the longest of the given keywords and returns its value, e.g.
+// `keywords<Verb>({{"get", Verb::Get}, {"put", Verb::Put}})`. Keywords are
+// dispatched on their first symbol, so only the ones sharing it are compared.
+// Of duplicate keywords the first one given wins. The table is built at
+// compile time if the parser is `constexpr`.
+template <class V, size_t N>
+inline auto constexpr keywords(Keyword<V> const (&entries)[N]) -> ParserLike
+    auto {
+    return Parser{[table = scan::KeywordTable<V, N>{entries}](
+                      std::string_view src, std::same_as<Track> auto... mode
+                  ) -> ParseResult<V> {
+        auto const keyword = table.find(src);
+
+        if (nullptr == keyword) {
+            basic::ErrorTracker<char>::report(src, "keyword", mode...);
+
+            return ParseResult<V>{.value = std::nullopt, .tail = src};
+        }
+
+        src.remove_prefix(keyword->name.size());
+
+        return ParseResult<V>{.value = keyword->value, .tail = src};
+    }};
+}
+
+enum class TrailingSeparator {
+    Disallowed,
+    Allowed,
+    Required,
+};
+
+namespace basic {
+    template <class Char>
+    struct List {
+        template <class T>
+        using ParserChar = BasicParser<T, Char>;
+
+        static auto constexpr list(
+            BasicParserLike<Char> auto elem_parser,
+            BasicParserLike<Char> auto separator_parser,
+            TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+            size_t min_elem_count = 0
+        ) -> BasicParserLike<Char> auto {
+            return List::list(
+                std::move(elem_parser), std::move(separator_parser),
+                trailing_sep, min_elem_count, std::allocator<void>{}
+            );
+        }
+
+        // Elements are allocated from `resource`
+        static auto list(
+            BasicParserLike<Char> auto elem_parser,
+            BasicParserLike<Char> auto separator_parser,
+            TrailingSeparator trailing_sep, size_t min_elem_count,
+            std::pmr::memory_resource* resource
+        ) -> BasicParserLike<Char> auto {
+            return List::list(
+                std::move(elem_parser), std::move(separator_parser),
+                trailing_sep, min_elem_count,
+                std::pmr::polymorphic_allocator<>{resource}
+            );
+        }
+
+        // Elements are stored in `std::vector` with the given allocator
+        static auto constexpr list(
+            BasicParserLike<Char> auto elem_parser,
+            BasicParserLike<Char> auto separator_parser,
+            TrailingSeparator trailing_sep, size_t min_elem_count,
+            AllocatorLike auto allocator
+        ) -> BasicParserLike<Char> auto {
+            return ParserChar{[elem_parser = std::move(elem_parser),
+                               separator_parser = std::move(separator_parser),
+                               trailing_sep, min_elem_count, allocator](
+                                  std::basic_string_view<Char> src,
+                                  ParseMode auto... mode
+                              ) {
+                using Elem = typename decltype(elem_parser)::ParseValue;
+                using Allocator = ReboundAllocator<decltype(allocator), Elem>;
+                using Value = std::vector<Elem, Allocator>;
+                using Result = std::conditional_t<
+                    has_tag<Recognize, decltype(mode)...>, BasicMatch<Char>,
+                    BasicParseResult<Value, Char>>;
+
+                auto values = Value(Allocator(allocator));
+
+                auto const [n_elems, tail, committed] = List::match_each(
+                    elem_parser, separator_parser, trailing_sep, src,
+                    [&]([[maybe_unused]] auto&& value) {
+                        if constexpr (!has_tag<Recognize, decltype(mode)...>) {
+                            values.emplace_back(std::move(value));
+                        }
+                    },
+                    mode...
+                );
+
+                if (committed || n_elems < min_elem_count) {
+                    return Result{
+                        .value = std::nullopt,
+                        .tail = src,
+                        .committed = committed,
+                    };
+                } else if constexpr (has_tag<Recognize, decltype(mode)...>) {
+                    return Result{.value = std::monostate{}, .tail = tail};
+                } else {
+                    return Result{
+                        .value = std::move(values),
+                        .tail = tail,
+                    };
+                }
+            }};
+        }
+
+        // Folds list elements as `accumulator = op(accumulator, value)`
+        // without storing them
+        static auto constexpr fold(
+            BasicParserLike<Char> auto elem_parser,
+            BasicParserLike<Char> auto separator_parser, auto init, auto op,
+            TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+            size_t min_elem_count = 0
+        ) -> BasicParserLike<Char> auto {
+            return ParserChar{[elem_parser = std::move(elem_parser),
+                               separator_parser = std::move(separator_parser),
+                               init = std::move(init), op = std::move(op),
+                               trailing_sep, min_elem_count](
+                                  std::basic_string_view<Char> src,
+                                  std::same_as<Track> auto... mode
+                              ) {
+                using Elem = typename decltype(elem_parser)::ParseValue;
+                using Accumulator = std::remove_cvref_t<decltype(init)>;
+
+                auto accumulator = init;
+
+                auto const [n_elems, tail, committed] = List::match_each(
+                    elem_parser, separator_parser, trailing_sep, src,
+                    [&](Elem&& value) {
+                        accumulator =
+                            op(std::move(accumulator), std::move(value));
+                    },
+                    mode...
+                );
+
+                if (committed || n_elems < min_elem_count) {
+                    return BasicParseResult<Accumulator, Char>{
+                        .value = std::nullopt,
+                        .tail = src,
+                        .committed = committed,
+                    };
+                } else {
+                    return BasicParseResult<Accumulator, Char>{
+                        .value = std::move(accumulator),
+                        .tail = tail,
+                    };
+                }
+            }};
+        }
+
+        // Passes list elements to `sink` and returns their number. Note that
+        // `sink` sees the elements even if the parser fails because there
+        // are less than `min_elem_count` of them.
+        static auto constexpr for_each(
+            BasicParserLike<Char> auto elem_parser,
+            BasicParserLike<Char> auto separator_parser, auto sink,
+            TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+            size_t min_elem_count = 0
+        ) -> BasicParserLike<Char> auto {
+            using Elem = typename decltype(elem_parser)::ParseValue;
+
+            return List::fold(
+                std::move(elem_parser), std::move(separator_parser), size_t{0},
+                [sink = std::move(sink)](size_t n_elems, Elem&& value) {
+                    sink(std::move(value));
+                    return n_elems + 1;
+                },
+                trailing_sep, min_elem_count
+            );
+        }
+
+        // Passes list elements starting at `src` to `consume`, returns the
+        // number of elements and the tail after the list. With a `Recognize`
+        // tag elements and separators are parsed without values.
+        template <ParseMode... Mode>
+        static auto constexpr match_each(
+            auto const& elem_parser, auto const& separator_parser,
+            TrailingSeparator trailing_sep, std::basic_string_view<Char> src,
+            auto&& consume, Mode... mode
+        ) -> BasicMatchCount<Char> {
+            using Elem = std::remove_cvref_t<
+                decltype(elem_parser.parse_as(src, mode...).get_value())>;
+
+            auto n_elems = size_t{0};
+            auto prev_tail = src;
+            auto tail = src;
+
+            // with a required trailing separator an element is passed on
+            // only after its separator is parsed
+            auto pending = std::optional<Elem>{};
+
+            auto const push = [&](Elem&& value) {
+                if (TrailingSeparator::Required == trailing_sep) {
+                    pending.emplace(std::move(value));
+                } else {
+                    consume(std::move(value));
+                    n_elems += 1;
+                }
+            };
+
+            auto first_result = elem_parser.parse_as(src, mode...);
+
+            if (!first_result.ok()) {
+                return {0, src, first_result.committed};
+            }
+
+            tail = first_result.tail;
+            push(std::move(first_result).get_value());
+
+            while (true) {
+                auto sep_result = separator_parser.parse_as(tail, mode...);
+
+                if (sep_result.committed) {
+                    return {n_elems, tail, true};
+                }
+
+                if (!sep_result.ok()) {
+                    if (TrailingSeparator::Required == trailing_sep) {
+                        tail = prev_tail;
+                    }
+
+                    break;
+                }
+
+                if (pending.has_value()) {
+                    consume(std::move(*pending));
+                    pending.reset();
+                    n_elems += 1;
+                }
+
+                prev_tail = tail;
+                tail = sep_result.tail;
+
+                auto elem_result = elem_parser.parse_as(tail, mode...);
+
+                if (elem_result.committed) {
+                    return {n_elems, tail, true};
+                }
+
+                if (!elem_result.ok()) {
+                    if (TrailingSeparator::Disallowed == trailing_sep) {
+                        tail = prev_tail;
+                    }
+
+                    break;
+                }
+
+                prev_tail = tail;
+                tail = elem_result.tail;
+
+                push(std::move(elem_result).get_value());
+            }
+
+            return {n_elems, tail, false};
+        }
+    };
+
+    template <class Char>
+    auto constexpr list(
+        BasicParserLike<Char> auto elem_parser,
+        BasicParserLike<Char> auto separator_parser,
+        TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+        size_t min_elem_count = 0
+    ) -> BasicParserLike<Char> auto {
+        return List<Char>::list(
+            std::move(elem_parser), std::move(separator_parser), trailing_sep,
+            min_elem_count
+        );
+    }
+
+    // `allocator` is either an allocator or a `std::pmr::memory_resource*`
+    template <class Char>
+    auto constexpr list(
+        BasicParserLike<Char> auto elem_parser,
+        BasicParserLike<Char> auto separator_parser,
+        TrailingSeparator trailing_sep, size_t min_elem_count, auto allocator
+    ) -> BasicParserLike<Char> auto {
+        return List<Char>::list(
+            std::move(elem_parser), std::move(separator_parser), trailing_sep,
+            min_elem_count, std::move(allocator)
+        );
+    }
+}  // namespace basic
+
+auto constexpr list(
+    ParserLike auto elem_parser, ParserLike auto separator_parser,
+    TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+    size_t min_elem_count = 0
+) -> ParserLike auto {
+    return basic::List<char>::list(
+        std::move(elem_parser), std::move(separator_parser), trailing_sep,
+        min_elem_count
+    );
+}
+
+// `allocator` is either an allocator or a `std::pmr::memory_resource*`
+auto constexpr list(
+    ParserLike auto elem_parser, ParserLike auto separator_parser,
+    TrailingSeparator trailing_sep, size_t min_elem_count, auto allocator
+) -> ParserLike auto {
+    return basic::List<char>::list(
+        std::move(elem_parser), std::move(separator_parser), trailing_sep,
+        min_elem_count, std::move(allocator)
+    );
+}
+
+auto constexpr list_fold(
+    ParserLike auto elem_parser, ParserLike auto separator_parser, auto init,
+    auto op, TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+    size_t min_elem_count = 0
+) -> ParserLike auto {
+    return basic::List<char>::fold(
+        std::move(elem_parser), std::move(separator_parser), std::move(init),
+        std::move(op), trailing_sep, min_elem_count
+    );
+}
+
+auto constexpr list_for_each(
+    ParserLike auto elem_parser, ParserLike auto separator_parser, auto sink,
+    TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
+    size_t min_elem_count = 0
+) -> ParserLike auto {
+    return basic::List<char>::for_each(
+        std::move(elem_parser), std::move(separator_parser), std::move(sink),
+        trailing_sep, min_elem_count
+    );
+}
+
+// Runs `parse` on `tail` and stores its value in `value` on success
+template <ParserLike P, std::same_as<Track>... Mode>
+auto constexpr __execute_parser_step(
+    P const& parse, std::optional<typename P::ParseValue>& value,
+    std::string_view& tail, bool& committed, Mode... mode
+) -> bool {
+    auto result = parse.parse_as(tail, mode...);
+
+    if (!result.ok()) {
+        committed = result.committed;
+        return false;
+    }
+
+    tail = result.tail;
+    value.emplace(std::move(result).get_value());
+
+    return true;
+}
+
+template <class S>
+auto constexpr collect(ParserLike auto... parser) -> ParserLike auto {
+    return Parser{
+        [... parse = std::move(parser)](
+            std::string_view src, std::same_as<Track> auto... mode
+        ) -> ParseResult<S> {
+            auto tail = src;
+            auto committed = false;
+            auto values =
+                std::tuple<std::optional<typename decltype(parse)::ParseValue
+                >...>{};
+
+            // `&&` folds left to right and stops at the first failure
+            auto const ok = [&]<size_t... I>(std::index_sequence<I...>) {
+                return (... && __execute_parser_step(
+                                   parse, std::get<I>(values), tail, committed,
+                                   mode...
+                               ));
+            }(std::index_sequence_for<decltype(parse)...>{});
+
+            if (!ok) {
+                return ParseResult<S>{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = committed,
+                };
+            }
+
+            return ParseResult<S>{
+                .value = std::apply(
+                    [](auto&&... value) {
+                        return std::make_optional<S>(S{std::move(*value)...});
+                    },
+                    std::move(values)
+                ),
+                .tail = tail,
+            };
+        }
+    };
+}
+
+namespace basic {
+    template <class Char>
+    struct Seq {
+        template <class T>
+        using ParserChar = BasicParser<T, Char>;
+
+        // Runs the parsers one after another in a single flat parser and
+        // keeps the values at indices `KEEP`, all of them if `KEEP` is empty.
+        // A single kept value is returned itself, several as a tuple, so
+        // `seq(p)` yields the value of `p`. Values at other indices are
+        // dropped as soon as they are parsed.
+        template <size_t... KEEP>
+        static auto constexpr seq(BasicParserLike<Char> auto... parser)
+            -> BasicParserLike<Char> auto {
+            static_assert(
+                sizeof...(parser) > 0, "sequence should not be empty"
+            );
+            static_assert(
+                ((KEEP < sizeof...(parser)) && ...),
+                "kept index should refer to a parser of the sequence"
+            );
+            static_assert(
+                Seq::is_increasing({KEEP...}),
+                "kept indices should be strictly increasing"
+            );
+
+            using Keep = std::conditional_t<
+                0 == sizeof...(KEEP),
+                std::index_sequence_for<decltype(parser)...>,
+                std::index_sequence<KEEP...>>;
+
+            return ParserChar{[parsers = std::tuple{std::move(parser)...}](
+                                  std::basic_string_view<Char> src,
+                                  ParseMode auto... mode
+                              ) {
+                return Seq::run(parsers, src, Keep{}, mode...);
+            }};
+        }
+
+    private:
+        template <class Parsers, size_t I>
+        using ValueAt = typename std::tuple_element_t<I, Parsers>::ParseValue;
+
+        static auto constexpr is_increasing(
+            std::initializer_list<size_t> indices
+        ) -> bool {
+            auto const unordered =
+                std::ranges::adjacent_find(indices, std::greater_equal<>{});
+
+            return indices.end() == unordered;
+        }
+
+        // position of `I` among `KEEP`, the number of kept values if absent
+        template <size_t I, size_t... KEEP>
+        static auto constexpr kept_position() -> size_t {
+            auto const indices = std::array<size_t, sizeof...(KEEP)>{KEEP...};
+
+            return (size_t) (std::ranges::find(indices, I) - indices.begin());
+        }
+
+        template <class Parsers, size_t... KEEP, class... Mode>
+        static auto constexpr run(
+            Parsers const& parsers, std::basic_string_view<Char> src,
+            std::index_sequence<KEEP...>, Mode... mode
+        ) {
+            using Kept = std::tuple<ValueAt<Parsers, KEEP>...>;
+            using Value = std::conditional_t<
+                1 == sizeof...(KEEP), std::tuple_element_t<0, Kept>, Kept>;
+
+            auto tail = src;
+            auto committed = false;
+            auto kept = std::tuple<std::optional<ValueAt<Parsers, KEEP>>...>{};
+
+            auto const step = [&]<size_t I>(auto const& parser) -> bool {
+                auto result = parser.parse_as(tail, mode...);
+
+                if (!result.ok()) {
+                    committed = result.committed;
+                    return false;
+                }
+
+                tail = result.tail;
+
+                auto constexpr POSITION = Seq::kept_position<I, KEEP...>();
+
+                if constexpr (has_tag<Recognize, Mode...>) {
+                    // values are not built with a `Recognize` tag
+                } else if constexpr (POSITION < sizeof...(KEEP)) {
+                    std::get<POSITION>(kept).emplace(
+                        std::move(result).get_value()
+                    );
+                }
+
+                return true;
+            };
+
+            // `&&` folds left to right and stops at the first failure
+            auto const ok = [&]<size_t... I>(std::index_sequence<I...>) {
+                return (... && step.template operator()<I>(
+                                   std::get<I>(parsers)
+                               ));
+            }(std::make_index_sequence<std::tuple_size_v<Parsers>>{});
+
+            using Result = std::conditional_t<
+                has_tag<Recognize, Mode...>, BasicMatch<Char>,
+                BasicParseResult<Value, Char>>;
+
+            if (!ok) {
+                return Result{
+                    .value = std::nullopt,
+                    .tail = src,
+                    .committed = committed,
+                };
+            }
+
+            if constexpr (has_tag<Recognize, Mode...>) {
+                return Result{.value = std::monostate{}, .tail = tail};
+            } else {
+                return Result{
+                    .value = std::apply(
+                        [](auto&&... value) {
+                            return std::make_optional<Value>(
+                                std::move(*value)...
+                            );
+                        },
+                        std::move(kept)
+                    ),
+                    .tail = tail,
+                };
+            }
+        }
+    };
+
+    template <class Char, size_t... KEEP>
+    auto constexpr seq(BasicParserLike<Char> auto... parser)
+        -> BasicParserLike<Char> auto {
+        return Seq<Char>::template seq<KEEP...>(std::move(parser)...);
+    }
+}  // namespace basic
+
+// Flat sequence of parsers, e.g. `seq<4>(prefix("name"), whitespace(),
+// character('='), whitespace(), quoted_string('\''))` keeps only the quoted
+// string. Without indices all values are kept as a tuple, except for a
+// single parser whose value is kept as is.
+template <size_t... KEEP>
+auto constexpr seq(ParserLike auto... parser) -> ParserLike auto {
+    return basic::Seq<char>::template seq<KEEP...>(std::move(parser)...);
+}
+
+namespace basic {
+    template <class Char>
+    struct Choice {
+        template <class T>
+        using ParserChar = BasicParser<T, Char>;
+
+        // Tries the parsers in order in a single flat parser and returns the
+        // value of the first one that matches. If all of them parse the same
+        // type the value has that type, otherwise it is a `std::variant`
+        // holding the value at the index of the matched parser.
+        static auto constexpr choice(BasicParserLike<Char> auto... parser)
+            -> BasicParserLike<Char> auto {
+            static_assert(
+                sizeof...(parser) > 0, "choice should not be empty"
+            );
+
+            return ParserChar{[parsers = std::tuple{std::move(parser)...}](
+                                  std::basic_string_view<Char> src,
+                                  ParseMode auto... mode
+                              ) { return Choice::run(parsers, src, mode...); }};
+        }
+
+    private:
+        template <class First, class... Rest>
+        using Value = std::conditional_t<
+            (std::same_as<First, Rest> && ...), First,
+            std::variant<First, Rest...>>;
+
+        template <class... P, class... Mode>
+        static auto constexpr run(
+            std::tuple<P...> const& parsers, std::basic_string_view<Char> src,
+            Mode... mode
+        ) {
+            using ChoiceValue = Value<typename P::ParseValue...>;
+            using Result = std::conditional_t<
+                has_tag<Recognize, Mode...>, BasicMatch<Char>,
+                BasicParseResult<ChoiceValue, Char>>;
+
+            auto constexpr IS_COMMON =
+                (std::same_as<typename P::ParseValue, ChoiceValue> && ...);
+
+            auto result = Result{.value = std::nullopt, .tail = src};
+
+            // returns whether to stop trying alternatives
+            auto const step = [&]<size_t I>(auto const& parser) -> bool {
+                auto alternative = parser.parse_as(src, mode...);
+
+                if (!alternative.ok()) {
+                    result.committed = alternative.committed;
+                    return alternative.committed;
+                }
+
+                if constexpr (has_tag<Recognize, Mode...>) {
+                    result.value.emplace();
+                } else if constexpr (IS_COMMON) {
+                    result.value.emplace(std::move(*alternative.value));
+                } else {
+                    result.value.emplace(
+                        std::in_place_index<I>, std::move(*alternative.value)
+                    );
+                }
+
+                result.tail = alternative.tail;
+
+                return true;
+            };
+
+            // `||` folds left to right and stops at the first match
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                (void) (... ||
+                        step.template operator()<I>(std::get<I>(parsers)));
+            }(std::index_sequence_for<P...>{});
+
+            return result;
+        }
+    };
+
+    template <class Char>
+    auto constexpr choice(BasicParserLike<Char> auto... parser)
+        -> BasicParserLike<Char> auto {
+        return Choice<Char>::choice(std::move(parser)...);
+    }
+}  // namespace basic
+
+// Flat alternative of parsers, `choice(a, b, c)` behaves like `a | b | c`
+// but also accepts parsers of different types and returns a `std::variant`
+// for them
+inline auto constexpr choice(ParserLike auto... parser) -> ParserLike auto {
+    return basic::Choice<char>::choice(std::move(parser)...);
 }
 
-inline auto constexpr floating() -> ParserLike auto {
-    return Parser{[](std::string_view src) -> ParseResult<double> {
-        errno = 0;
-        char* parse_end = nullptr;
-        auto const value = std::strtod(src.data(), &parse_end);
-        auto const parse_size = (size_t) (parse_end - src.data());
+namespace basic {
+    // Per-parse packrat table. Memoized rules run inside `MemoTable::parse`
+    // cache their results by (rule, offset), so backtracking alternatives
+    // re-entering a rule at the same position cost one lookup. Outside of
+    // `MemoTable::parse` memoized rules just run their parser. A `Track`
+    // tag is passed on to the parser, so a parse function calling `parse`
+    // can forward it. Results are kept until the next `parse` or `clear`.
+    template <class Char>
+    class MemoTable {
+    public:
+        // At most `max_entries` results are cached per parse, later ones are
+        // computed without caching
+        explicit MemoTable(
+            size_t max_entries = std::numeric_limits<size_t>::max()
+        )
+            : max_entries{max_entries} {}
+
+        template <BasicParserLike<Char> P, std::same_as<Track>... Mode>
+        auto parse(
+            this MemoTable& self, P const& parser,
+            std::basic_string_view<Char> src, Mode... mode
+        ) -> BasicParseResult<typename P::ParseValue, Char> {
+            struct ScopeGuard {
+                MemoTable* previous;
+
+                ~ScopeGuard() {
+                    current = previous;
+                }
+            };
+
+            self.entries.clear();
+            self.input = src;
+
+            auto const guard = ScopeGuard{std::exchange(current, &self)};
+
+            return parser.parse_as(src, mode...);
+        }
+
+        // Drops the cached results and releases their memory
+        auto clear(this MemoTable& self) -> void {
+            self.entries = {};
+        }
+
+    private:
+        template <class>
+        friend struct Memoize;
+
+        struct Key {
+            size_t rule;
+            size_t offset;
+
+            friend auto constexpr operator==(Key, Key) -> bool = default;
+        };
+
+        struct KeyHash {
+            auto operator()(Key key) const -> size_t {
+                return std::hash<size_t>{}(
+                    key.offset * 0x9E3779B97F4A7C15 ^ key.rule
+                );
+            }
+        };
+
+        struct Entry {
+            // `Value const` of a success, `nullptr` of a failure
+            std::shared_ptr<void const> value;
+            std::basic_string_view<Char> tail;
+            bool committed;
+            // tracker the failures were reported to while computing the
+            // result, `nullptr` if they were not reported
+            ErrorTracker<Char> const* tracker;
+        };
+
+        // offset of `src` in the current input, if `src` is its suffix
+        auto offset_of(
+            this MemoTable const& self, std::basic_string_view<Char> src
+        ) -> std::optional<size_t> {
+            auto const begin = (uintptr_t) self.input.data();
+            auto const end = begin + self.input.size() * sizeof(Char);
+            auto const src_begin = (uintptr_t) src.data();
+            auto const src_end = src_begin + src.size() * sizeof(Char);
+
+            if (src_begin < begin || src_end != end) {
+                return std::nullopt;
+            }
+
+            return (src_begin - begin) / sizeof(Char);
+        }
+
+        static auto new_rule_id() -> size_t {
+            return n_rules.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline static thread_local MemoTable* current = nullptr;
+        inline static std::atomic<size_t> n_rules = 0;
+
+        std::unordered_map<Key, Entry, KeyHash> entries;
+        std::basic_string_view<Char> input;
+        size_t max_entries;
+    };
+
+    template <class Char>
+    struct Memoize {
+        template <class T>
+        using ParserChar = BasicParser<T, Char>;
+
+        static auto memoize(BasicParserLike<Char> auto parser)
+            -> BasicParserLike<Char> auto {
+            using Table = MemoTable<Char>;
+            using Value = typename decltype(parser)::ParseValue;
+            using Result = BasicParseResult<Value, Char>;
+
+            static_assert(
+                std::copy_constructible<Value>,
+                "memoized parser values are returned by copy"
+            );
+
+            return ParserChar{[parser = std::move(parser),
+                               rule = Table::new_rule_id()](
+                                  std::basic_string_view<Char> src,
+                                  std::same_as<Track> auto... mode
+                              ) -> Result {
+                auto const table = Table::current;
+
+                if (nullptr == table) {
+                    return parser.parse_as(src, mode...);
+                }
+
+                auto const offset = table->offset_of(src);
+
+                if (!offset.has_value()) {
+                    return parser.parse_as(src, mode...);
+                }
+
+                auto const key = typename Table::Key{
+                    .rule = rule,
+                    .offset = *offset,
+                };
+
+                auto tracker = (ErrorTracker<Char> const*) nullptr;
+
+                if constexpr (0 != sizeof...(mode)) {
+                    tracker = ErrorTracker<Char>::installed();
+                }
+
+                // a cached result is computed again for a tracker that did
+                // not see its failures, so they are reported to it
+                if (auto const entry = table->entries.find(key);
+                    entry != table->entries.end() &&
+                    (nullptr == tracker || tracker == entry->second.tracker))
+                {
+                    auto const& cached = entry->second;
+
+                    if (nullptr == cached.value) {
+                        return Result{
+                            .value = std::nullopt,
+                            .tail = cached.tail,
+                            .committed = cached.committed,
+                        };
+                    }
 
-        if (0 != errno || parse_size > src.size() || parse_size == 0) {
-            return ParseResult<double>{.value = std::nullopt, .tail = src};
-        } else {
-            src.remove_prefix(parse_size);
-            return ParseResult<double>{.value = value, .tail = src};
+                    return Result{
+                        .value = *static_cast<Value const*>(cached.value.get()),
+                        .tail = cached.tail,
+                    };
+                }
+
+                auto result = parser.parse_as(src, mode...);
+
+                if (table->entries.size() < table->max_entries) {
+                    auto value = std::shared_ptr<Value const>{};
+
+                    if (result.ok()) {
+                        value = std::make_shared<Value const>(*result.value);
+                    }
+
+                    table->entries.insert_or_assign(
+                        key, typename Table::Entry{
+                                 .value = std::move(value),
+                                 .tail = result.tail,
+                                 .committed = result.committed,
+                                 .tracker = tracker,
+                             }
+                    );
+                }
+
+                return result;
+            }};
         }
-    }};
-}
+    };
 
-inline auto constexpr whitespace(uint32_t min_count = 0) -> ParserLike auto {
-    return Parser{
-        [min_count](std::string_view src) -> ParseResult<std::string_view> {
-            auto n_spaces = size_t{0};
+    template <class Char>
+    auto memoize(BasicParserLike<Char> auto parser)
+        -> BasicParserLike<Char> auto {
+        return Memoize<Char>::memoize(std::move(parser));
+    }
+}  // namespace basic
 
-            for (auto symbol : src) {
-                if (!is_whitespace(symbol)) {
-                    break;
+using MemoTable = basic::MemoTable<char>;
+
+namespace basic {
+    // Grammar rule that can refer to itself. The rule is built once with
+    // `define` and parsers returned by `ref` call into it without owning it,
+    // so the rule must outlive every grammar built from its references.
+    template <class T, class Char>
+    class Rule {
+    public:
+        using ParseValue = T;
+
+        template <class S>
+        using ParserChar = BasicParser<S, Char>;
+
+        auto ref(this Rule const& self) -> BasicParserLike<Char> auto {
+            return ParserChar{[definition = self.definition.get()](
+                                  std::basic_string_view<Char> src,
+                                  ParseMode auto... mode
+                              ) {
+                auto constexpr IS_RECOGNIZING =
+                    has_tag<Recognize, decltype(mode)...>;
+                auto constexpr IS_TRACKING = has_tag<Track, decltype(mode)...>;
+
+                if constexpr (IS_RECOGNIZING && IS_TRACKING) {
+                    return definition->match_tracked(src);
+                } else if constexpr (IS_RECOGNIZING) {
+                    return definition->match(src);
+                } else if constexpr (IS_TRACKING) {
+                    return definition->parse_tracked(src);
+                } else {
+                    return definition->parse(src);
                 }
+            }};
+        }
 
-                n_spaces += 1;
-            }
+        auto define(this Rule& self, BasicParserLike<Char> auto parser)
+            -> void {
+            static_assert(
+                std::same_as<typename decltype(parser)::ParseValue, T>,
+                "rule definition should parse the rule's value type"
+            );
 
-            if (n_spaces < min_count) {
-                return ParseResult<std::string_view>{
-                    .value = std::nullopt, .tail = src
-                };
-            } else {
-                auto match = src;
-                match.remove_suffix(src.size() - n_spaces);
-                src.remove_prefix(n_spaces);
+            using Src = std::basic_string_view<Char>;
 
-                return ParseResult<std::string_view>{
-                    .value = match, .tail = src
-                };
-            }
+            // one copy of the grammar shared by the four entry points
+            auto const shared =
+                std::make_shared<decltype(parser) const>(std::move(parser));
+            auto& definition = *self.definition;
+
+            definition.parse = [shared](Src src) {
+                return shared->parse(src);
+            };
+            definition.parse_tracked = [shared](Src src) {
+                return shared->parse_as(src, Track{});
+            };
+            definition.match = [shared](Src src) {
+                return shared->match(src);
+            };
+            definition.match_tracked = [shared](Src src) {
+                return shared->match(src, Track{});
+            };
+        }
+
+        auto parse(this Rule const& self, std::basic_string_view<Char> src)
+            -> BasicParseResult<T, Char> {
+            return self.definition->parse(src);
+        }
+
+        auto operator()(
+            this Rule const& self, std::basic_string_view<Char> src
+        ) -> BasicParseResult<T, Char> {
+            return self.definition->parse(src);
         }
+
+    private:
+        template <class V>
+        using Function = std::function<V(std::basic_string_view<Char>)>;
+
+        // the definition called with each combination of tags
+        struct Definition {
+            Function<BasicParseResult<T, Char>> parse;
+            Function<BasicParseResult<T, Char>> parse_tracked;
+            Function<BasicMatch<Char>> match;
+            Function<BasicMatch<Char>> match_tracked;
+        };
+
+        std::shared_ptr<Definition> definition =
+            std::make_shared<Definition>();
     };
+
+    // Builds a rule from `build(self)`, where `self` refers to the rule
+    template <class T, class Char, class F>
+    auto recursive(F build) -> Rule<T, Char> {
+        auto rule = Rule<T, Char>{};
+        rule.define(build(rule.ref()));
+
+        return rule;
+    }
+}  // namespace basic
+
+template <class T>
+using Rule = basic::Rule<T, char>;
+
+template <class T, class F>
+auto recursive(F build) -> Rule<T> {
+    return basic::recursive<T, char>(std::move(build));
 }
 
-inline auto constexpr newline() -> ParserLike auto {
-    return prefix("\r\n") | prefix("\n") | prefix("\r");
+inline auto memoize(ParserLike auto parser) -> ParserLike auto {
+    return basic::Memoize<char>::memoize(std::move(parser));
 }
 
-inline auto constexpr end() -> ParserLike auto {
-    return Parser{[](std::string_view src) -> ParseResult<std::string_view> {
-        if (src.empty()) {
-            return ParseResult<std::string_view>{
-                .value = std::make_optional<std::string_view>(src),
-                .tail = src,
-            };
-        } else {
-            return ParseResult<std::string_view>{
-                .value = std::nullopt,
-                .tail = src,
-            };
+namespace basic {
+    // Parse function of any parser producing `T`. Parsers up to
+    // `INLINE_SIZE` bytes are stored in place, larger ones on the heap.
+    // Calling it is one indirect call in either case.
+    template <class T, class Char>
+    class AnyParseFunction {
+    public:
+        // the whole function fits in a 64 byte cache line
+        static constexpr size_t INLINE_SIZE = 64 - 2 * sizeof(void*);
+
+        template <BasicParserLike<Char> P>
+            requires(!std::same_as<decltype(P::parse), AnyParseFunction>)
+        AnyParseFunction(P parser) {
+            static_assert(
+                std::same_as<typename P::ParseValue, T>,
+                "erased parser should parse the erased value type"
+            );
+
+            using F = decltype(P::parse);
+            using Impl = Model<F, fits_inline<F>()>;
+
+            Impl::emplace(this->storage, std::move(parser.parse));
+            this->call = &Impl::call;
+            this->ops = &Impl::OPS;
         }
-    }};
-}
 
-inline auto constexpr quoted_string(char quote_symbol = '"') -> ParserLike
-    auto {
-    return Parser{
-        [quote_symbol](std::string_view src) -> ParseResult<std::string_view> {
-            auto open_quote = character(quote_symbol).parse(src);
-            auto tail = open_quote.tail;
+        // does not wrap an erased parser again
+        template <BasicParserLike<Char> P>
+            requires std::same_as<decltype(P::parse), AnyParseFunction>
+        AnyParseFunction(P parser)
+            : AnyParseFunction(std::move(parser.parse)) {}
 
-            if (!open_quote.ok()) {
-                return ParseResult<std::string_view>{
-                    .value = std::nullopt, .tail = src
-                };
+        AnyParseFunction(AnyParseFunction const& other)
+            : call{other.call}, ops{other.ops} {
+            this->ops->copy(other.storage, this->storage);
+        }
+
+        AnyParseFunction(AnyParseFunction&& other) noexcept
+            : call{other.call}, ops{other.ops} {
+            this->ops->move(other.storage, this->storage);
+        }
+
+        auto operator=(this AnyParseFunction& self, AnyParseFunction other)
+            -> AnyParseFunction& {
+            self.ops->destroy(self.storage);
+            other.ops->move(other.storage, self.storage);
+            self.call = other.call;
+            self.ops = other.ops;
+
+            return self;
+        }
+
+        ~AnyParseFunction() {
+            this->ops->destroy(this->storage);
+        }
+
+        // with a `Track` tag the call goes through the operations table
+        auto operator()(
+            this AnyParseFunction const& self, std::basic_string_view<Char> src,
+            std::same_as<Track> auto... mode
+        ) -> BasicParseResult<T, Char> {
+            if constexpr (0 != sizeof...(mode)) {
+                return self.ops->call_tracked(self.storage, src);
+            } else {
+                return self.call(self.storage, src);
             }
+        }
+
+        // Whether the parser is stored in place rather than on the heap
+        auto is_inline(this AnyParseFunction const& self) -> bool {
+            return self.ops->is_inline;
+        }
 
-            auto n_string_symbols = size_t{0};
+    private:
+        using Call = auto (*)(void const*, std::basic_string_view<Char>)
+            -> BasicParseResult<T, Char>;
 
-            for (auto symbol : tail) {
-                if (quote_symbol == symbol) {
-                    break;
+        struct Ops {
+            Call call_tracked;
+            void (*copy)(void const* from, void* to);
+            void (*move)(void* from, void* to);
+            void (*destroy)(void* storage);
+            bool is_inline;
+        };
+
+        template <class F>
+        static auto constexpr fits_inline() -> bool {
+            return sizeof(F) <= INLINE_SIZE &&
+                   alignof(F) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible_v<F>;
+        }
+
+        template <class F, bool IS_INLINE>
+        struct Model {
+            static auto object(void const* storage) -> F const& {
+                if constexpr (IS_INLINE) {
+                    return *std::launder(static_cast<F const*>(storage));
+                } else {
+                    return **static_cast<F* const*>(storage);
                 }
+            }
 
-                n_string_symbols += 1;
+            static auto emplace(void* storage, F&& function) -> void {
+                if constexpr (IS_INLINE) {
+                    new (storage) F(std::move(function));
+                } else {
+                    new (storage) F*(new F(std::move(function)));
+                }
             }
 
-            if (n_string_symbols == tail.size() ||
-                quote_symbol != tail[n_string_symbols])
-            {
-                return ParseResult<std::string_view>{
-                    .value = std::nullopt, .tail = src
-                };
+            static auto call(
+                void const* storage, std::basic_string_view<Char> src
+            ) -> BasicParseResult<T, Char> {
+                return Model::object(storage)(src);
             }
 
-            auto match = tail;
-            match.remove_suffix(src.size() - 1 - n_string_symbols);
-            tail.remove_prefix(n_string_symbols + 1);
+            static auto call_tracked(
+                void const* storage, std::basic_string_view<Char> src
+            ) -> BasicParseResult<T, Char> {
+                auto const& function = Model::object(storage);
 
-            return ParseResult<std::string_view>{.value = match, .tail = tail};
-        }
+                if constexpr (requires { function(src, Track{}); }) {
+                    return function(src, Track{});
+                } else {
+                    return function(src);
+                }
+            }
+
+            static auto copy(void const* from, void* to) -> void {
+                if constexpr (IS_INLINE) {
+                    new (to) F(Model::object(from));
+                } else {
+                    new (to) F*(new F(Model::object(from)));
+                }
+            }
+
+            static auto move(void* from, void* to) -> void {
+                if constexpr (IS_INLINE) {
+                    new (to) F(std::move(*std::launder(static_cast<F*>(from))));
+                } else {
+                    auto& function = *static_cast<F**>(from);
+                    new (to) F*(std::exchange(function, nullptr));
+                }
+            }
+
+            static auto destroy(void* storage) -> void {
+                if constexpr (IS_INLINE) {
+                    std::launder(static_cast<F*>(storage))->~F();
+                } else {
+                    delete *static_cast<F**>(storage);
+                }
+            }
+
+            static constexpr Ops OPS = {
+                .call_tracked = &Model::call_tracked,
+                .copy = &Model::copy,
+                .move = &Model::move,
+                .destroy = &Model::destroy,
+                .is_inline = IS_INLINE,
+            };
+        };
+
+        Call call;
+        Ops const* ops;
+        alignas(std::max_align_t) std::byte storage[INLINE_SIZE];
     };
+
+    // Parser of `T` with its type erased, e.g. to keep alternatives chosen
+    // at runtime in a container or to cut a deep combinator type at a rule
+    // boundary. Converts implicitly from any parser of `T`.
+    template <class T, class Char>
+    using AnyParser = BasicParser<AnyParseFunction<T, Char>, Char>;
+
+    template <class Char>
+    auto erase(BasicParserLike<Char> auto parser)
+        -> AnyParser<typename decltype(parser)::ParseValue, Char> {
+        return {std::move(parser)};
+    }
+}  // namespace basic
+
+template <class T>
+using AnyParser = basic::AnyParser<T, char>;
+
+inline auto erase(ParserLike auto parser)
+    -> AnyParser<typename decltype(parser)::ParseValue> {
+    return basic::erase<char>(std::move(parser));
 }
 
-enum class TrailingSeparator {
-    Disallowed,
-    Allowed,
-    Required,
+enum class StreamStatus {
+    NeedMoreInput,
+    Done,
+    Error,
 };
 
 namespace basic {
-    template <class Char>
-    struct List {
-        template <class T>
-        using ParserChar = BasicParser<T, Char>;
+    // Parses a sequence of records from input arriving in chunks. Only the
+    // unfinished record is kept between chunks.
+    //
+    // With a `terminator`, a symbol every record ends with and contains
+    // nowhere else, a record is complete once its parse consumes the
+    // terminator. A record failing to parse although its terminator has
+    // arrived is an error right away.
+    //
+    // Without one a record is complete once its parser succeeds with input
+    // left over, so it is passed to the sink when the next chunk shows
+    // where it ends. A grammar ending in an optional part then depends on
+    // where the chunks are split, e.g. `prefix("ab") >> prefix("cd").opt()`
+    // fed "abc" and "d" ends its record after "ab". A record failing to
+    // parse is treated as incomplete until it grows past `max_record_size`.
+    //
+    // Parsers keep no state between calls, so an unfinished record is
+    // parsed again from its start. Past `EAGER_RETRY_SIZE` it is retried
+    // only once it has doubled since the last attempt, which keeps the work
+    // on a large record fed in small chunks linear in its size. A chunk
+    // containing `terminator`, the symbol records end with if there is one,
+    // is always retried, so live feeds get their records without waiting
+    // for the next doubling. A record past `max_record_size` is retried
+    // once before it is rejected.
+    template <class P, class Char>
+    class StreamParser {
+    public:
+        using ParseValue = typename P::ParseValue;
+
+        explicit StreamParser(
+            P parser, size_t max_record_size,
+            std::optional<Char> terminator = std::nullopt
+        )
+            : parser{std::move(parser)}
+            , max_record_size{max_record_size}
+            , terminator{terminator} {}
+
+        // Parses all complete records in the input fed so far. Values
+        // borrowing from the input are valid only during the `sink` call.
+        auto feed(
+            this StreamParser& self, std::basic_string_view<Char> chunk,
+            auto&& sink
+        ) -> StreamStatus {
+            if (StreamStatus::NeedMoreInput != self.status) {
+                return self.status;
+            }
 
-        static auto constexpr list(
-            BasicParserLike<Char> auto elem_parser,
-            BasicParserLike<Char> auto separator_parser,
-            TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
-            size_t min_elem_count = 0
-        ) -> BasicParserLike<Char> auto {
-            return ParserChar{[elem_parser = std::move(elem_parser),
-                               separator_parser = std::move(separator_parser),
-                               trailing_sep,
-                               min_elem_count](std::basic_string_view<Char> src
-                              ) {
-                using Elem = decltype(elem_parser.parse(src).get_value());
-                using Value = std::vector<Elem>;
+            if (self.buffer.empty()) {
+                self.buffer.assign(self.parse_records(chunk, sink, false));
+            } else {
+                self.buffer.append(chunk);
 
-                auto values = Value{};
-                auto prev_tail = std::basic_string_view<Char>{};
-                auto tail = src;
-                auto empty_result = BasicParseResult<Value, Char>{
-                    .value = std::nullopt,
-                    .tail = src,
-                };
+                auto const may_end =
+                    self.terminator.has_value() &&
+                    std::basic_string_view<Char>::npos !=
+                        chunk.find(*self.terminator);
 
-                if (auto first_result = elem_parser.parse(src);
-                    first_result.ok())
+                // not grown enough since the last attempt
+                if (!may_end && self.buffer.size() < self.retry_size &&
+                    self.buffer.size() <= self.max_record_size)
                 {
-                    prev_tail = tail;
-                    tail = first_result.tail;
-                    values.emplace_back(std::move(first_result).get_value());
+                    return StreamStatus::NeedMoreInput;
+                }
+
+                auto const tail = self.parse_records(self.buffer, sink, false);
+                self.buffer.erase(0, self.buffer.size() - tail.size());
+            }
 
-                    while (true) {
-                        auto sep_result = separator_parser.parse(tail);
+            self.retry_size = self.buffer.size() < EAGER_RETRY_SIZE
+                                  ? 0
+                                  : 2 * self.buffer.size();
 
-                        if (!sep_result.ok()) {
-                            if (TrailingSeparator::Required == trailing_sep) {
-                                values.pop_back();
-                                tail = prev_tail;
-                            }
+            return self.check_record_size();
+        }
 
-                            break;
-                        }
+        // Parses the records left at the end of input
+        auto finish(this StreamParser& self, auto&& sink) -> StreamStatus {
+            if (StreamStatus::NeedMoreInput != self.status) {
+                return self.status;
+            }
 
-                        prev_tail = tail;
-                        tail = sep_result.tail;
+            auto const tail = self.parse_records(self.buffer, sink, true);
 
-                        auto elem_result = elem_parser.parse(tail);
+            if (StreamStatus::NeedMoreInput == self.status) {
+                self.status =
+                    tail.empty() ? StreamStatus::Done : StreamStatus::Error;
+            }
 
-                        if (!elem_result.ok()) {
-                            if (TrailingSeparator::Disallowed == trailing_sep) {
-                                tail = prev_tail;
-                            }
+            self.buffer.clear();
 
-                            break;
-                        }
+            return self.status;
+        }
+
+        // Input of the record waiting for more data
+        auto pending(this StreamParser const& self)
+            -> std::basic_string_view<Char> {
+            return self.buffer;
+        }
+
+        auto reset(this StreamParser& self) -> void {
+            self.buffer.clear();
+            self.retry_size = 0;
+            self.status = StreamStatus::NeedMoreInput;
+        }
+
+        // Size of the unfinished record below which it is parsed again on
+        // every `feed`
+        static constexpr size_t EAGER_RETRY_SIZE = 4096;
 
-                        prev_tail = tail;
-                        tail = elem_result.tail;
+    private:
+        auto check_record_size(this StreamParser& self) -> StreamStatus {
+            if (StreamStatus::NeedMoreInput == self.status &&
+                self.buffer.size() > self.max_record_size)
+            {
+                self.status = StreamStatus::Error;
+            }
+
+            return self.status;
+        }
 
-                        values.emplace_back(std::move(elem_result).get_value());
+        auto parse_records(
+            this StreamParser& self, std::basic_string_view<Char> src,
+            auto& sink, bool at_end
+        ) -> std::basic_string_view<Char> {
+            while (!src.empty()) {
+                auto result = self.parser.parse(src);
+
+                // malformed rather than incomplete if its terminator arrived
+                if (!result.ok()) {
+                    if (self.has_terminator(src)) {
+                        self.status = StreamStatus::Error;
                     }
+
+                    break;
                 }
 
-                if (values.size() < min_elem_count) {
-                    return empty_result;
-                } else {
-                    return BasicParseResult<Value, Char>{
-                        .value = std::move(values),
-                        .tail = tail,
-                    };
+                // an empty record would never let the stream advance
+                if (result.tail.size() == src.size()) {
+                    self.status = StreamStatus::Error;
+                    break;
                 }
-            }};
+
+                auto const record =
+                    src.substr(0, src.size() - result.tail.size());
+                auto const is_complete = self.terminator.has_value()
+                                             ? self.has_terminator(record)
+                                             : !result.tail.empty();
+
+                if (!at_end && !is_complete) {
+                    break;
+                }
+
+                src = result.tail;
+                sink(std::move(result).get_value());
+            }
+
+            return src;
+        }
+
+        auto has_terminator(
+            this StreamParser const& self, std::basic_string_view<Char> src
+        ) -> bool {
+            return self.terminator.has_value() &&
+                   std::basic_string_view<Char>::npos !=
+                       src.find(*self.terminator);
         }
+
+        P parser;
+        size_t max_record_size;
+        std::optional<Char> terminator;
+        std::basic_string<Char> buffer{};
+        // buffer size at which the unfinished record is parsed again
+        size_t retry_size = 0;
+        StreamStatus status = StreamStatus::NeedMoreInput;
     };
 
     template <class Char>
-    auto constexpr list(
-        BasicParserLike<Char> auto elem_parser,
-        BasicParserLike<Char> auto separator_parser,
-        TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
-        size_t min_elem_count = 0
-    ) -> BasicParserLike<Char> auto {
-        return List<Char>::list(
-            std::move(elem_parser), std::move(separator_parser), trailing_sep,
-            min_elem_count
-        );
+    auto stream_parser(
+        BasicParserLike<Char> auto parser, size_t max_record_size = 1 << 20,
+        std::optional<Char> terminator = std::nullopt
+    ) {
+        return StreamParser<decltype(parser), Char>{
+            std::move(parser), max_record_size, terminator
+        };
     }
 }  // namespace basic
 
-auto constexpr list(
-    ParserLike auto elem_parser, ParserLike auto separator_parser,
-    TrailingSeparator trailing_sep = TrailingSeparator::Allowed,
-    size_t min_elem_count = 0
-) -> ParserLike auto {
-    return basic::List<char>::list(
-        std::move(elem_parser), std::move(separator_parser), trailing_sep,
-        min_elem_count
+template <class P>
+using StreamParser = basic::StreamParser<P, char>;
+
+inline auto stream_parser(
+    ParserLike auto parser, size_t max_record_size = 1 << 20,
+    std::optional<char> terminator = std::nullopt
+) -> StreamParser<decltype(parser)> {
+    return basic::stream_parser<char>(
+        std::move(parser), max_record_size, terminator
     );
 }
 
-using DummyThrowType = struct {};
+// Error policy of `comb::parse` returning the bare parse result. The parser
+// is called without a `Track` tag, so no failure is reported.
+struct NoErrors {
+    template <class Char>
+    static auto constexpr parse(
+        BasicParserLike<Char> auto const& parser,
+        std::basic_string_view<Char> src
+    ) {
+        return parser.parse(src);
+    }
+};
+
+template <class T, class Char>
+struct BasicParseReport {
+    BasicParseResult<T, Char> result;
+    // `std::nullopt` if no parser failed
+    std::optional<basic::ParseError<Char>> error;
+};
 
-template <ParserLike P>
-auto constexpr __execute_parser_throw(P parse, std::string_view& tail)
-    -> P::ParseValue {
-    auto result = parse(tail);
+template <class T>
+using ParseReport = BasicParseReport<T, char>;
+
+// Error policy of `comb::parse` also reporting the furthest failure. Failures
+// of backtracked alternatives are kept, so a successful parse may still
+// carry an error, e.g. the reason a repetition stopped.
+struct FurthestFailure {
+    template <class Char, BasicParserLike<Char> P>
+    static auto parse(P const& parser, std::basic_string_view<Char> src)
+        -> BasicParseReport<typename P::ParseValue, Char> {
+        auto tracker = basic::ErrorTracker<Char>{};
+        auto result = tracker.parse(parser, src);
+
+        return BasicParseReport<typename P::ParseValue, Char>{
+            .result = std::move(result),
+            .error = tracker.error(),
+        };
+    }
+};
 
-    if (!result.ok()) {
-        throw DummyThrowType{};
+namespace basic {
+    template <class Policy, class Char>
+    auto constexpr parse(
+        BasicParserLike<Char> auto const& parser,
+        std::basic_string_view<Char> src
+    ) {
+        return Policy::template parse<Char>(parser, src);
     }
+}  // namespace basic
 
-    tail = result.tail;
+using ParseError = basic::ParseError<char>;
 
-    return std::move(result).get_value();
+// Runs `parser` on `src` with the given error policy
+template <class Policy = NoErrors>
+auto constexpr parse(ParserLike auto const& parser, std::string_view src) {
+    return basic::parse<Policy, char>(parser, src);
 }
 
-template <class S>
-auto constexpr collect(ParserLike auto... parser) -> ParserLike auto {
-    return Parser{
-        [... parse =
-             std::move(parser)](std::string_view src) -> ParseResult<S> {
-            auto tail = src;
+namespace basic {
+    template <class Char>
+    auto constexpr validate(
+        BasicParserLike<Char> auto const& parser,
+        std::basic_string_view<Char> src
+    ) -> bool {
+        auto const result = parser.match(src);
 
-            try {
-                return ParseResult<S>{
-                    .value = std::make_optional<S>(
-                        // use braced initializer to force evaluation order
-                        S{__execute_parser_throw(parse, tail)...}
-                    ),
-                    .tail = tail,
-                };
-            } catch ([[maybe_unused]] DummyThrowType error) {
-                return ParseResult<S>{
-                    .value = std::nullopt,
-                    .tail = src,
-                };
-            }
-        }
-    };
+        return result.ok() && result.tail.empty();
+    }
+}  // namespace basic
+
+// Whether `parser` matches the whole of `src`, checked through `match`
+// without building the values of the library's combinators
+auto constexpr validate(ParserLike auto const& parser, std::string_view src)
+    -> bool {
+    return basic::validate<char>(parser, src);
 }
 
 }  // namespace comb
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "parse.hpp"
+
+#if defined(COMB_PROFILE_CYCLES) && __has_include(<x86intrin.h>)
+#    include <x86intrin.h>
+#endif
+
+namespace comb {
+
+namespace profile {
+    // Counters of a rule wrapped with `named`
+    struct RuleStats {
+        std::string name;
+        uint64_t n_calls;
+        uint64_t n_successes;
+        uint64_t n_failures;
+        // symbols consumed by successful calls
+        uint64_t n_consumed;
+        // symbols consumed again by successful calls starting before the
+        // furthest position the rule reached in the same `Pass`
+        uint64_t n_rescanned;
+        // time spent in the rule including nested rules, in TSC cycles or
+        // nanoseconds, only measured with `COMB_PROFILE_CYCLES`
+        uint64_t n_cycles;
+    };
+
+    class RuleCounters {
+    public:
+        auto record(
+            this RuleCounters& self, bool ok, uint64_t n_consumed,
+            uint64_t n_rescanned, uint64_t n_cycles
+        ) -> void {
+            auto constexpr relaxed = std::memory_order_relaxed;
+
+            self.n_calls.fetch_add(1, relaxed);
+            self.n_cycles.fetch_add(n_cycles, relaxed);
+
+            if (!ok) {
+                self.n_failures.fetch_add(1, relaxed);
+                return;
+            }
+
+            self.n_successes.fetch_add(1, relaxed);
+            self.n_consumed.fetch_add(n_consumed, relaxed);
+            self.n_rescanned.fetch_add(n_rescanned, relaxed);
+        }
+
+        auto stats(this RuleCounters const& self, std::string name)
+            -> RuleStats {
+            return RuleStats{
+                .name = std::move(name),
+                .n_calls = self.n_calls.load(),
+                .n_successes = self.n_successes.load(),
+                .n_failures = self.n_failures.load(),
+                .n_consumed = self.n_consumed.load(),
+                .n_rescanned = self.n_rescanned.load(),
+                .n_cycles = self.n_cycles.load(),
+            };
+        }
+
+        auto reset(this RuleCounters& self) -> void {
+            for (auto* counter :
+                 {&self.n_calls, &self.n_successes, &self.n_failures,
+                  &self.n_consumed, &self.n_rescanned, &self.n_cycles})
+            {
+                counter->store(0);
+            }
+        }
+
+    private:
+        std::atomic<uint64_t> n_calls = 0;
+        std::atomic<uint64_t> n_successes = 0;
+        std::atomic<uint64_t> n_failures = 0;
+        std::atomic<uint64_t> n_consumed = 0;
+        std::atomic<uint64_t> n_rescanned = 0;
+        std::atomic<uint64_t> n_cycles = 0;
+    };
+
+    // Furthest offsets named rules reached during one call of the outermost
+    // named rule on this thread, which installs the pass. Offsets are
+    // relative to that call's input, so rescans are counted per parse and
+    // threads never share a pass.
+    template <class Char>
+    class Pass {
+    public:
+        explicit Pass(std::basic_string_view<Char> input)
+            : input{input}
+            , previous{std::exchange(current, this)} {}
+
+        Pass(Pass const&) = delete;
+        auto operator=(Pass const&) -> Pass& = delete;
+
+        ~Pass() {
+            current = this->previous;
+        }
+
+        static auto is_active() -> bool {
+            return nullptr != current;
+        }
+
+        // Symbols between `src` and `tail` that the rule of `counters`
+        // already consumed in the active pass
+        static auto rescanned(
+            RuleCounters const& counters, std::basic_string_view<Char> src,
+            std::basic_string_view<Char> tail
+        ) -> uint64_t {
+            auto& self = *current;
+            auto const input_end = self.input.data() + self.input.size();
+
+            // not a suffix of the input, e.g. a nested buffer
+            if (src.data() < self.input.data() ||
+                src.data() + src.size() != input_end)
+            {
+                return 0;
+            }
+
+            auto const begin = (size_t) (src.data() - self.input.data());
+            auto const end = begin + (src.size() - tail.size());
+            auto const [entry, is_new] =
+                self.furthest.try_emplace(&counters, end);
+
+            if (is_new) {
+                return 0;
+            }
+
+            auto const furthest = std::exchange(
+                entry->second, std::max(entry->second, end)
+            );
+
+            return begin < furthest ? std::min(end, furthest) - begin : 0;
+        }
+
+    private:
+        inline static thread_local Pass* current = nullptr;
+
+        std::basic_string_view<Char> input;
+        Pass* previous;
+        std::map<RuleCounters const*, size_t> furthest;
+    };
+
+    // Process-wide counters of named rules. Rules sharing a name share
+    // their counters.
+    class Registry {
+    public:
+        static auto get() -> Registry& {
+            static auto registry = Registry{};
+            return registry;
+        }
+
+        auto counters(this Registry& self, std::string_view name)
+            -> RuleCounters& {
+            auto const lock = std::scoped_lock{self.mutex};
+
+            if (auto const entry = self.rules.find(name);
+                entry != self.rules.end())
+            {
+                return entry->second;
+            }
+
+            return self.rules[std::string{name}];
+        }
+
+        auto snapshot(this Registry& self) -> std::vector<RuleStats> {
+            auto const lock = std::scoped_lock{self.mutex};
+            auto result = std::vector<RuleStats>{};
+
+            for (auto const& [name, counters] : self.rules) {
+                result.push_back(counters.stats(name));
+            }
+
+            return result;
+        }
+
+        auto reset(this Registry& self) -> void {
+            auto const lock = std::scoped_lock{self.mutex};
+
+            for (auto& [name, counters] : self.rules) {
+                counters.reset();
+            }
+        }
+
+    private:
+        Registry() = default;
+
+        std::mutex mutex;
+        // nodes of `std::map` never move, so rules keep their counters
+        std::map<std::string, RuleCounters, std::less<>> rules;
+    };
+
+    inline auto now() -> uint64_t {
+#if defined(COMB_PROFILE_CYCLES) && __has_include(<x86intrin.h>)
+        return __rdtsc();
+#elif defined(COMB_PROFILE_CYCLES)
+        auto const time = std::chrono::steady_clock::now().time_since_epoch();
+        return (uint64_t) std::chrono::nanoseconds{time}.count();
+#else
+        return 0;
+#endif
+    }
+
+    // Counters of all named rules, empty without `COMB_PROFILE`
+    inline auto snapshot() -> std::vector<RuleStats> {
+        return Registry::get().snapshot();
+    }
+
+    inline auto reset() -> void {
+        Registry::get().reset();
+    }
+
+    // Prints the counters as a table sorted by time, then by calls
+    inline auto dump(std::FILE* file = stderr) -> void {
+        auto stats = snapshot();
+
+        std::ranges::sort(stats, std::greater<>{}, [](RuleStats const& rule) {
+            return std::pair{rule.n_cycles, rule.n_calls};
+        });
+
+        std::fprintf(
+            file, "%-32s %12s %12s %12s %14s %14s %16s\n", "rule", "calls",
+            "successes", "failures", "consumed", "rescanned", "cycles"
+        );
+
+        for (auto const& rule : stats) {
+            std::fprintf(
+                file, "%-32s %12llu %12llu %12llu %14llu %14llu %16llu\n",
+                rule.name.c_str(), (unsigned long long) rule.n_calls,
+                (unsigned long long) rule.n_successes,
+                (unsigned long long) rule.n_failures,
+                (unsigned long long) rule.n_consumed,
+                (unsigned long long) rule.n_rescanned,
+                (unsigned long long) rule.n_cycles
+            );
+        }
+    }
+}  // namespace profile
+
+namespace basic {
+    // Counts calls of `parser` under `name` in `profile::Registry` if
+    // `COMB_PROFILE` is defined, returns `parser` itself otherwise
+    template <class Char>
+    auto named(std::string_view name, BasicParserLike<Char> auto parser)
+        -> BasicParserLike<Char> auto {
+#ifdef COMB_PROFILE
+        auto parse = [parser = std::move(parser),
+                      &counters = profile::Registry::get().counters(name)](
+                         std::basic_string_view<Char> src,
+                         ParseMode auto... mode
+                     ) {
+            using Pass = profile::Pass<Char>;
+
+            // the outermost named rule starts a pass over its input
+            auto pass = std::optional<Pass>{};
+
+            if (!Pass::is_active()) {
+                pass.emplace(src);
+            }
+
+            auto const start = profile::now();
+            auto result = parser.parse_as(src, mode...);
+            auto const n_cycles = profile::now() - start;
+
+            if (!result.ok()) {
+                counters.record(false, 0, 0, n_cycles);
+                return result;
+            }
+
+            counters.record(
+                true, src.size() - result.tail.size(),
+                Pass::rescanned(counters, src, result.tail), n_cycles
+            );
+
+            return result;
+        };
+
+        return BasicParser<decltype(parse), Char>{std::move(parse)};
+#else
+        (void) name;
+        return parser;
+#endif
+    }
+}  // namespace basic
+
+inline auto named(std::string_view name, ParserLike auto parser)
+    -> ParserLike auto {
+    return basic::named<char>(name, std::move(parser));
+}
+
+}  // namespace comb
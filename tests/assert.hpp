@@ -1,11 +1,24 @@
 #pragma once
 
+#include <cstdlib>
+#include <stdexcept>
 #include <fmt/format.h>
 
+// Fails the current test, without exceptions the test binary exits
+#ifdef __cpp_exceptions
+#define comb_fail(message) throw std::runtime_error(message)
+#else
+#define comb_fail(message)                                 \
+    ({                                                     \
+        fmt::print(stderr, " failed:\n    {}\n", message); \
+        std::exit(EXIT_FAILURE);                           \
+    })
+#endif
+
 #define comb_assert(expr)                                                    \
     ({                                                                        \
         if (!(expr)) {                                                        \
-            throw std::runtime_error(fmt::format(                             \
+            comb_fail(fmt::format(                                            \
                 "test '{}' failed: assetion '{}' failed", __FUNCTION__, #expr \
             ));                                                               \
         }                                                                     \
@@ -17,7 +30,7 @@
         auto const right_result = (right);                             \
                                                                        \
         if (left_result != right_result) {                             \
-            throw std::runtime_error(fmt::format(                      \
+            comb_fail(fmt::format(                                     \
                 "test '{}' failed: assertion '{} == {}' "              \
                 "failed with left = '{}' and right = '{}'",            \
                 __FUNCTION__, #left, #right, left_result, right_result \
@@ -31,7 +44,7 @@
         auto const right_result = (right);                             \
                                                                        \
         if (left_result == right_result) {                             \
-            throw std::runtime_error(fmt::format(                      \
+            comb_fail(fmt::format(                                     \
                 "test '{}' failed: assertion '{} != {}' "              \
                 "failed with left = '{}' and right = '{}'",            \
                 __FUNCTION__, #left, #right, left_result, right_result \
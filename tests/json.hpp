@@ -5,6 +5,9 @@
 #include <vector>
 #include <unordered_map>
 #include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <optional>
 #include <comb/parse.hpp>
 
 namespace json {
@@ -21,6 +24,7 @@ enum class JsonVariant {
 using JsonBool = bool;
 using JsonInteger = int64_t;
 using JsonFloat = double;
+// raw string contents, escape sequences are not decoded
 using JsonString = std::string_view;
 using JsonList = std::vector<struct JsonValue>;
 using JsonObject = std::unordered_map<std::string_view, struct JsonValue>;
@@ -51,6 +55,9 @@ struct JsonValue {
 
 auto parse(std::string_view src) -> comb::ParseResult<JsonValue>;
 
+// Whether `src` is one JSON value, checked without building it
+auto validate(std::string_view src) -> bool;
+
 inline auto json() -> comb::ParserLike auto {
     auto parse = [](std::string_view src) -> comb::ParseResult<JsonValue> {
         return ::json::parse(src);
@@ -59,4 +66,479 @@ inline auto json() -> comb::ParserLike auto {
     return comb::Parser<decltype(parse)>{std::move(parse)};
 }
 
+// Receives the events of `parse_events`. Strings and keys are raw, escape
+// sequences are not decoded. `count` is the number of elements or members.
+template <class T>
+concept JsonHandler = requires(T handler, comb::EscapedString string) {
+    handler.on_null();
+    handler.on_bool(JsonBool{});
+    handler.on_integer(JsonInteger{});
+    handler.on_float(JsonFloat{});
+    handler.on_string(string);
+    handler.on_key(string);
+    handler.on_list_begin();
+    handler.on_list_end(size_t{});
+    handler.on_object_begin();
+    handler.on_object_end(size_t{});
+};
+
+// Nesting limit of lists and objects
+inline auto constexpr MAX_DEPTH = size_t{1024};
+
+// Recursive descent behind `parse_events`
+template <JsonHandler Handler>
+class EventParser {
+public:
+    inline explicit EventParser(Handler& handler)
+    : handler{handler} {}
+
+    // Parses the value at the start of `src`, returns the source after it
+    inline auto value(std::string_view src, size_t depth)
+        -> std::optional<std::string_view> {
+        src = skip_whitespace(src);
+
+        if (src.empty()) {
+            return std::nullopt;
+        }
+
+        switch (src[0]) {
+        case '[':
+            return this->container(src.substr(1), depth, false);
+        case '{':
+            return this->container(src.substr(1), depth, true);
+        case '"':
+            return this->string(src, false);
+        case 't':
+            return this->literal(comb::prefix<"true">()(src), [this] {
+                this->handler.on_bool(true);
+            });
+        case 'f':
+            return this->literal(comb::prefix<"false">()(src), [this] {
+                this->handler.on_bool(false);
+            });
+        case 'n':
+            return this->literal(comb::prefix<"null">()(src), [this] {
+                this->handler.on_null();
+            });
+        default:
+            return this->number(src);
+        }
+    }
+
+    static inline auto skip_whitespace(std::string_view src)
+        -> std::string_view {
+        return src.substr(comb::scan::count_whitespace(src));
+    }
+
+private:
+    inline auto literal(
+        comb::ParseResult<std::string_view> const& result, auto on_match
+    ) -> std::optional<std::string_view> {
+        if (!result.ok()) {
+            return std::nullopt;
+        }
+
+        on_match();
+
+        return result.tail;
+    }
+
+    inline auto string(std::string_view src, bool is_key)
+        -> std::optional<std::string_view> {
+        auto const result = comb::escaped_string()(src);
+
+        if (!result.ok()) {
+            return std::nullopt;
+        }
+
+        if (is_key) {
+            this->handler.on_key(result.get_value());
+        } else {
+            this->handler.on_string(result.get_value());
+        }
+
+        return result.tail;
+    }
+
+    inline auto number(std::string_view src)
+        -> std::optional<std::string_view> {
+        if (src.starts_with('+')) {
+            return std::nullopt;
+        }
+
+        // JSON forbids leading zeros such as `01` or `-01`
+        auto const digits = src.substr(src.starts_with('-') ? 1 : 0);
+
+        if (digits.size() > 1 && '0' == digits[0] && '0' <= digits[1] &&
+            digits[1] <= '9') {
+            return std::nullopt;
+        }
+
+        auto const integer = comb::integer<JsonInteger>()(src);
+        auto const is_fraction = [](std::string_view tail) {
+            return !tail.empty() &&
+                   ('.' == tail[0] || 'e' == tail[0] || 'E' == tail[0]);
+        };
+
+        if (integer.ok() && !is_fraction(integer.tail)) {
+            this->handler.on_integer(integer.get_value());
+            return integer.tail;
+        }
+
+        auto const floating =
+            comb::floating<JsonFloat>(comb::FloatFormat::Json)(src);
+
+        if (!floating.ok()) {
+            return std::nullopt;
+        }
+
+        this->handler.on_float(floating.get_value());
+
+        return floating.tail;
+    }
+
+    // Parses a list or an object, `src` starts after the opening bracket
+    inline auto container(std::string_view src, size_t depth, bool is_object)
+        -> std::optional<std::string_view> {
+        if (MAX_DEPTH == depth) {
+            return std::nullopt;
+        }
+
+        auto const close = is_object ? '}' : ']';
+        auto count = size_t{0};
+
+        if (is_object) {
+            this->handler.on_object_begin();
+        } else {
+            this->handler.on_list_begin();
+        }
+
+        src = skip_whitespace(src);
+
+        while (!src.starts_with(close)) {
+            if (is_object) {
+                auto const key = this->string(src, true);
+
+                if (!key.has_value()) {
+                    return std::nullopt;
+                }
+
+                src = skip_whitespace(*key);
+
+                if (!src.starts_with(':')) {
+                    return std::nullopt;
+                }
+
+                src.remove_prefix(1);
+            }
+
+            auto const tail = this->value(src, depth + 1);
+
+            if (!tail.has_value()) {
+                return std::nullopt;
+            }
+
+            count += 1;
+            src = skip_whitespace(*tail);
+
+            if (src.starts_with(',')) {
+                src = skip_whitespace(src.substr(1));
+
+                if (src.starts_with(close)) {
+                    return std::nullopt;
+                }
+            } else if (!src.starts_with(close)) {
+                return std::nullopt;
+            }
+        }
+
+        if (is_object) {
+            this->handler.on_object_end(count);
+        } else {
+            this->handler.on_list_end(count);
+        }
+
+        return src.substr(1);
+    }
+
+    Handler& handler;
+};
+
+// Parses a JSON value and reports its scalars and container boundaries to
+// `handler` in document order, without building a `JsonValue`. The parsed
+// value is the JSON text. On failure the events already sent stand.
+template <JsonHandler Handler>
+inline auto parse_events(std::string_view src, Handler& handler)
+    -> comb::ParseResult<std::string_view> {
+    auto const begin = EventParser<Handler>::skip_whitespace(src);
+    auto const tail = EventParser<Handler>{handler}.value(begin, 0);
+
+    if (!tail.has_value()) {
+        return comb::ParseResult<std::string_view>{
+            .value = std::nullopt, .tail = src
+        };
+    }
+
+    return comb::ParseResult<std::string_view>{
+        .value = begin.substr(0, begin.size() - tail->size()),
+        .tail = EventParser<Handler>::skip_whitespace(*tail),
+    };
+}
+
+template <JsonHandler Handler>
+inline auto events(Handler& handler) -> comb::ParserLike auto {
+    auto parse = [&handler](std::string_view src
+                 ) -> comb::ParseResult<std::string_view> {
+        return ::json::parse_events(src, handler);
+    };
+
+    return comb::Parser<decltype(parse)>{std::move(parse)};
+}
+
+// Tag in the high byte of a tape word
+enum class TapeTag : uint8_t {
+    Null = 'n',
+    True = 't',
+    False = 'f',
+    Integer = 'l',
+    Float = 'd',
+    String = '"',
+    ListBegin = '[',
+    ListEnd = ']',
+    ObjectBegin = '{',
+    ObjectEnd = '}',
+};
+
+class TapeValue;
+
+// JSON document flattened into one array of 64-bit words. Each value starts
+// with a word holding its tag in the high byte and a 56-bit payload:
+// - `Integer`, `Float`: no payload, the value bits are in the next word
+// - `String`: offset of the raw contents in the source, the next word holds
+//   the length and has the high bit set if the string has escapes
+// - `ListBegin`, `ObjectBegin`: index past the matching end word in the low
+//   32 bits and the number of elements (saturated) in the upper 24 bits
+// - `ListEnd`, `ObjectEnd`: index of the matching begin word
+// Object members are stored as a key string followed by the value. Strings
+// point into the source, so it must outlive the tape. Sources of 4 GiB and
+// more are rejected, their skip pointers would not fit into 32 bits.
+struct Tape {
+    std::string_view source;
+    std::vector<uint64_t> words;
+
+    inline auto root(this Tape const& self) -> TapeValue;
+};
+
+class TapeListIterator;
+class TapeObjectIterator;
+
+template <class Iterator>
+struct TapeRange {
+    Iterator first;
+    Iterator last;
+
+    inline auto begin(this TapeRange const& self) -> Iterator {
+        return self.first;
+    }
+
+    inline auto end(this TapeRange const& self) -> Iterator {
+        return self.last;
+    }
+};
+
+// Reference to a value on the tape
+class TapeValue {
+public:
+    inline TapeValue(Tape const* tape, size_t index)
+    : tape{tape}
+    , index{index} {}
+
+    inline auto tag(this TapeValue const& self) -> TapeTag {
+        return TapeTag(self.word() >> 56);
+    }
+
+    inline auto get_bool(this TapeValue const& self) -> JsonBool {
+        return TapeTag::True == self.tag();
+    }
+
+    inline auto get_integer(this TapeValue const& self) -> JsonInteger {
+        return std::bit_cast<JsonInteger>(self.tape->words[self.index + 1]);
+    }
+
+    inline auto get_float(this TapeValue const& self) -> JsonFloat {
+        return std::bit_cast<JsonFloat>(self.tape->words[self.index + 1]);
+    }
+
+    // raw string contents, escape sequences are not decoded
+    inline auto get_string(this TapeValue const& self) -> JsonString {
+        auto const length = self.tape->words[self.index + 1];
+
+        return self.tape->source.substr(
+            self.payload(), length & ~(uint64_t{1} << 63)
+        );
+    }
+
+    inline auto has_escapes(this TapeValue const& self) -> bool {
+        return 0 != self.tape->words[self.index + 1] >> 63;
+    }
+
+    // Number of list elements or object members
+    inline auto size(this TapeValue const& self) -> size_t {
+        return self.payload() >> 32;
+    }
+
+    // Index of the word after this value, containers are skipped in O(1)
+    inline auto next_index(this TapeValue const& self) -> size_t {
+        switch (self.tag()) {
+        case TapeTag::Integer:
+        case TapeTag::Float:
+        case TapeTag::String:
+            return self.index + 2;
+        case TapeTag::ListBegin:
+        case TapeTag::ObjectBegin:
+            return self.payload() & UINT32_MAX;
+        default:
+            return self.index + 1;
+        }
+    }
+
+    inline auto get_index(this TapeValue const& self) -> size_t {
+        return self.index;
+    }
+
+    inline auto elements(this TapeValue const& self)
+        -> TapeRange<TapeListIterator>;
+
+    inline auto members(this TapeValue const& self)
+        -> TapeRange<TapeObjectIterator>;
+
+    // Value of the first member named `key` of an object
+    inline auto find(this TapeValue const& self, std::string_view key)
+        -> std::optional<TapeValue>;
+
+private:
+    inline auto word(this TapeValue const& self) -> uint64_t {
+        return self.tape->words[self.index];
+    }
+
+    inline auto payload(this TapeValue const& self) -> uint64_t {
+        return self.word() & ((uint64_t{1} << 56) - 1);
+    }
+
+    Tape const* tape;
+    size_t index;
+};
+
+struct TapeMember {
+    JsonString key;
+    TapeValue value;
+};
+
+class TapeListIterator {
+public:
+    using value_type = TapeValue;
+    using difference_type = ptrdiff_t;
+
+    inline TapeListIterator(Tape const* tape, size_t index)
+    : tape{tape}
+    , index{index} {}
+
+    inline auto operator*(this TapeListIterator const& self) -> TapeValue {
+        return TapeValue{self.tape, self.index};
+    }
+
+    inline auto operator++(this TapeListIterator& self) -> TapeListIterator& {
+        self.index = (*self).next_index();
+        return self;
+    }
+
+    inline auto operator++(this TapeListIterator& self, int)
+        -> TapeListIterator {
+        auto const previous = self;
+        ++self;
+        return previous;
+    }
+
+    friend inline auto operator==(TapeListIterator, TapeListIterator)
+        -> bool = default;
+
+private:
+    Tape const* tape;
+    size_t index;
+};
+
+class TapeObjectIterator {
+public:
+    using value_type = TapeMember;
+    using difference_type = ptrdiff_t;
+
+    inline TapeObjectIterator(Tape const* tape, size_t index)
+    : tape{tape}
+    , index{index} {}
+
+    inline auto operator*(this TapeObjectIterator const& self) -> TapeMember {
+        return TapeMember{
+            .key = TapeValue{self.tape, self.index}.get_string(),
+            .value = TapeValue{self.tape, self.index + 2},
+        };
+    }
+
+    inline auto operator++(this TapeObjectIterator& self)
+        -> TapeObjectIterator& {
+        self.index = (*self).value.next_index();
+        return self;
+    }
+
+    inline auto operator++(this TapeObjectIterator& self, int)
+        -> TapeObjectIterator {
+        auto const previous = self;
+        ++self;
+        return previous;
+    }
+
+    friend inline auto operator==(TapeObjectIterator, TapeObjectIterator)
+        -> bool = default;
+
+private:
+    Tape const* tape;
+    size_t index;
+};
+
+inline auto Tape::root(this Tape const& self) -> TapeValue {
+    return TapeValue{&self, 0};
+}
+
+inline auto TapeValue::elements(this TapeValue const& self)
+    -> TapeRange<TapeListIterator> {
+    return TapeRange<TapeListIterator>{
+        .first = TapeListIterator{self.tape, self.index + 1},
+        .last = TapeListIterator{self.tape, self.next_index() - 1},
+    };
+}
+
+inline auto TapeValue::members(this TapeValue const& self)
+    -> TapeRange<TapeObjectIterator> {
+    return TapeRange<TapeObjectIterator>{
+        .first = TapeObjectIterator{self.tape, self.index + 1},
+        .last = TapeObjectIterator{self.tape, self.next_index() - 1},
+    };
+}
+
+inline auto TapeValue::find(this TapeValue const& self, std::string_view key)
+    -> std::optional<TapeValue> {
+    for (auto const member : self.members()) {
+        if (member.key == key) {
+            return member.value;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// Parses a JSON value into `tape` with `parse_events`, reusing its storage.
+// The tape is reserved up front from a count of the structural characters in
+// `src`, so parsing allocates at most once.
+auto parse_tape(std::string_view src, Tape& tape)
+    -> comb::ParseResult<TapeValue>;
+
 }  // namespace json
@@ -5,57 +5,82 @@ namespace json {
 
 using namespace comb;
 
+static auto make_grammar() -> Rule<JsonValue> {
+    return recursive<JsonValue>([](ParserLike auto json) {
+        auto parse_bool = keywords<bool>({{"false", false}, {"true", true}})
+                              .map([](auto value) { return JsonValue{value}; });
+
+        auto parse_integer =
+            integer().map([](auto value) { return JsonValue{value}; });
+
+        auto parse_float =
+            floating().map([](auto value) { return JsonValue{value}; });
+
+        auto parse_string = escaped_string().map([](auto string) {
+            return JsonValue{string.raw};
+        });
+
+        // no other value starts with a bracket, so a malformed list or
+        // object fails without trying the remaining alternatives
+        auto parse_list =
+            (character<'['>() >>
+             (whitespace() >>
+              list(
+                  json, whitespace() >> character<','>() << whitespace(),
+                  TrailingSeparator::Disallowed
+              ) << whitespace()
+                << character<']'>())
+                 .expect())
+                .map([](auto list) { return JsonValue{std::move(list)}; });
+
+        auto key = escaped_string().map([](auto string) { return string.raw; });
+
+        auto key_value = (std::move(key) << whitespace() << character<':'>()) &
+                         (whitespace() >> json);
+
+        auto parse_object =
+            (character<'{'>() >>
+             (whitespace() >>
+              list(
+                  std::move(key_value),
+                  whitespace() >> character<','>() << whitespace(),
+                  TrailingSeparator::Disallowed
+              ) << whitespace()
+                << character<'}'>())
+                 .expect())
+                .map([](auto pair_list) {
+                    auto result =
+                        std::unordered_map<std::string_view, JsonValue>{};
+
+                    for (auto pair : std::move(pair_list)) {
+                        result.insert(std::move(pair));
+                    }
+
+                    return JsonValue{std::move(result)};
+                });
+
+        return whitespace() >>
+               choice(
+                   std::move(parse_bool), std::move(parse_integer),
+                   std::move(parse_float), std::move(parse_string),
+                   std::move(parse_list), std::move(parse_object)
+               ) << whitespace();
+    });
+}
+
+static auto grammar() -> Rule<JsonValue> const& {
+    // the grammar refers to itself, so it is built once and shared
+    static auto const grammar = make_grammar();
+
+    return grammar;
+}
+
 auto parse(std::string_view src) -> ParseResult<JsonValue> {
-    auto parse_bool = prefix("false").map([](auto) {
-        return JsonValue{false};
-    }) | prefix("true").map([](auto) { return JsonValue{true}; });
-
-    auto parse_integer =
-        integer().map([](auto value) { return JsonValue{value}; });
-
-    auto parse_float =
-        floating().map([](auto value) { return JsonValue{value}; });
-
-    auto parse_string =
-        quoted_string().map([](auto string) { return JsonValue{string}; });
-
-    auto parse_list =
-        (character('[') >> whitespace() >>
-         list(
-             json(), whitespace() >> character(',') << whitespace(),
-             TrailingSeparator::Disallowed
-         ) << whitespace()
-           << character(']'))
-            .map([](auto list) { return JsonValue{std::move(list)}; });
-
-    auto key_value = (quoted_string() << whitespace() << character(':')) &
-                     (whitespace() >> json());
-
-    auto parse_object =
-        (character('{') >> whitespace() >>
-         list(
-             std::move(key_value),
-             whitespace() >> character(',') << whitespace(),
-             TrailingSeparator::Disallowed
-         ) << whitespace()
-           << character('}'))
-            .map([](auto pair_list) {
-                auto result = std::unordered_map<std::string_view, JsonValue>{};
-
-                for (auto pair : std::move(pair_list)) {
-                    result.insert(std::move(pair));
-                }
-
-                return JsonValue{std::move(result)};
-            });
-
-    auto parse_value =
-        whitespace() >> (std::move(parse_bool) | std::move(parse_integer) |
-                         std::move(parse_float) | std::move(parse_string) |
-                         std::move(parse_list) | std::move(parse_object)
-                        ) << whitespace();
-
-    return parse_value(src);
+    return grammar().parse(src);
+}
+
+auto validate(std::string_view src) -> bool {
+    return comb::validate(grammar().ref(), src);
 }
 
 }  // namespace json
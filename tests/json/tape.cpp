@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <array>
+#include "../json.hpp"
+
+namespace json {
+
+using namespace comb;
+
+namespace {
+
+auto constexpr MAX_COUNT = (uint64_t{1} << 24) - 1;
+auto constexpr PAYLOAD_MASK = (uint64_t{1} << 56) - 1;
+
+auto constexpr tape_word(TapeTag tag, uint64_t payload) -> uint64_t {
+    return (uint64_t) tag << 56 | (payload & PAYLOAD_MASK);
+}
+
+// `parse_events` handler appending values to the tape
+class TapeWriter {
+public:
+    explicit TapeWriter(Tape& tape)
+    : tape{tape} {}
+
+    auto on_null() -> void {
+        this->tape.words.push_back(tape_word(TapeTag::Null, 0));
+    }
+
+    auto on_bool(JsonBool value) -> void {
+        this->tape.words.push_back(
+            tape_word(value ? TapeTag::True : TapeTag::False, 0)
+        );
+    }
+
+    auto on_integer(JsonInteger value) -> void {
+        this->tape.words.push_back(tape_word(TapeTag::Integer, 0));
+        this->tape.words.push_back(std::bit_cast<uint64_t>(value));
+    }
+
+    auto on_float(JsonFloat value) -> void {
+        this->tape.words.push_back(tape_word(TapeTag::Float, 0));
+        this->tape.words.push_back(std::bit_cast<uint64_t>(value));
+    }
+
+    auto on_string(EscapedString string) -> void {
+        auto const offset = string.raw.data() - this->tape.source.data();
+
+        this->tape.words.push_back(tape_word(TapeTag::String, offset));
+        this->tape.words.push_back(
+            string.raw.size() | (uint64_t) string.has_escapes << 63
+        );
+    }
+
+    auto on_key(EscapedString string) -> void {
+        this->on_string(string);
+    }
+
+    auto on_list_begin() -> void {
+        this->open();
+    }
+
+    auto on_list_end(size_t count) -> void {
+        this->close(TapeTag::ListBegin, TapeTag::ListEnd, count);
+    }
+
+    auto on_object_begin() -> void {
+        this->open();
+    }
+
+    auto on_object_end(size_t count) -> void {
+        this->close(TapeTag::ObjectBegin, TapeTag::ObjectEnd, count);
+    }
+
+private:
+    auto open() -> void {
+        this->begins[this->depth++] = this->tape.words.size();
+
+        // patched with the skip pointer once the end is known
+        this->tape.words.push_back(0);
+    }
+
+    auto close(TapeTag begin_tag, TapeTag end_tag, size_t count) -> void {
+        auto& words = this->tape.words;
+        auto const begin = this->begins[--this->depth];
+        auto const end = words.size();
+
+        words.push_back(tape_word(end_tag, begin));
+        words[begin] = tape_word(
+            begin_tag, std::min((uint64_t) count, MAX_COUNT) << 32 | (end + 1)
+        );
+    }
+
+    Tape& tape;
+    // tape indices of the open containers' begin words
+    std::array<size_t, MAX_DEPTH> begins;
+    size_t depth = 0;
+};
+
+}  // namespace
+
+auto parse_tape(std::string_view src, Tape& tape) -> ParseResult<TapeValue> {
+    tape.source = src;
+    tape.words.clear();
+
+    // skip pointers are 32 bit, tape indices never exceed the source size
+    if (src.size() >= UINT32_MAX) {
+        return ParseResult<TapeValue>{.value = std::nullopt, .tail = src};
+    }
+
+    // every key and value but the root follows one of `[{,:` and takes at
+    // most two words, so the tape does not grow while parsing
+    auto const n_values = 1 + (size_t) std::ranges::count_if(src, [](char c) {
+        return '[' == c || '{' == c || ',' == c || ':' == c;
+    });
+
+    tape.words.reserve(2 * n_values);
+
+    auto writer = TapeWriter{tape};
+    auto const result = parse_events(src, writer);
+
+    if (!result.ok()) {
+        tape.words.clear();
+
+        return ParseResult<TapeValue>{.value = std::nullopt, .tail = src};
+    }
+
+    return ParseResult<TapeValue>{.value = tape.root(), .tail = result.tail};
+}
+
+}  // namespace json
@@ -7,27 +7,50 @@ auto main() -> int {
     perform_test(test_code_from_example);
     perform_test(test_second_example);
     perform_test(test_parse_char);
+    perform_test(test_parse_literals);
+    perform_test(test_parse_char_class);
     perform_test(test_parse_sequence);
     perform_test(test_parse_combine);
     perform_test(test_parse_integer);
+    perform_test(test_parse_integer_types);
     perform_test(test_parse_whitespaces);
+    perform_test(test_parse_whitespaces_long);
+    perform_test(test_parse_file);
     perform_test(test_parse_newline);
     perform_test(test_parse_quoted_string);
+    perform_test(test_parse_escaped_string);
     perform_test(test_parse_parser_sequence);
     perform_test(test_parse_parser_right);
     perform_test(test_parse_parser_left_right);
     perform_test(test_parse_parser_map);
+    perform_test(test_parse_keywords);
     perform_test(test_parse_parser_vector_sequence);
+    perform_test(test_parse_fold);
     perform_test(test_parse_opt);
     perform_test(test_parse_opt_default);
     perform_test(test_parse_list);
+    perform_test(test_parse_list_allocator);
     perform_test(test_parse_list_disallowed_trailing_sep);
     perform_test(test_parse_list_required_trailing_sep);
     perform_test(test_parse_list_min_n_elems);
     perform_test(test_parse_pair);
     perform_test(test_parse_json);
     perform_test(test_parse_json_object);
+    perform_test(test_parse_json_tape);
+    perform_test(test_parse_json_events);
     perform_test(test_parse_float);
+    perform_test(test_parse_float_formats);
     perform_test(test_parse_collect);
     perform_test(test_parse_end);
+    perform_test(test_parse_memo);
+    perform_test(test_parse_rule);
+    perform_test(test_parse_stream);
+    perform_test(test_parse_parallel_repeat);
+    perform_test(test_parse_errors);
+    perform_test(test_parse_named);
+    perform_test(test_parse_expect);
+    perform_test(test_parse_any_parser);
+    perform_test(test_parse_seq);
+    perform_test(test_parse_choice);
+    perform_test(test_parse_recognize);
 }
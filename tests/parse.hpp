@@ -8,27 +8,50 @@ auto test_code_from_example() -> void;
 auto test_second_example() -> void;
 auto test_parse_sequence() -> void;
 auto test_parse_char() -> void;
+auto test_parse_literals() -> void;
+auto test_parse_char_class() -> void;
 auto test_parse_combine() -> void;
 auto test_parse_integer() -> void;
+auto test_parse_integer_types() -> void;
 auto test_parse_whitespaces() -> void;
+auto test_parse_whitespaces_long() -> void;
+auto test_parse_file() -> void;
 auto test_parse_newline() -> void;
 auto test_parse_quoted_string() -> void;
+auto test_parse_escaped_string() -> void;
 auto test_parse_parser_sequence() -> void;
 auto test_parse_parser_right() -> void;
 auto test_parse_parser_left_right() -> void;
 auto test_parse_parser_map() -> void;
+auto test_parse_keywords() -> void;
 auto test_parse_parser_vector_sequence() -> void;
+auto test_parse_fold() -> void;
 auto test_parse_opt() -> void;
 auto test_parse_opt_default() -> void;
 auto test_parse_list() -> void;
+auto test_parse_list_allocator() -> void;
 auto test_parse_list_disallowed_trailing_sep() -> void;
 auto test_parse_list_required_trailing_sep() -> void;
 auto test_parse_list_min_n_elems() -> void;
 auto test_parse_pair() -> void;
 auto test_parse_json() -> void;
 auto test_parse_json_object() -> void;
+auto test_parse_json_tape() -> void;
+auto test_parse_json_events() -> void;
 auto test_parse_float() -> void;
+auto test_parse_float_formats() -> void;
 auto test_parse_collect() -> void;
 auto test_parse_end() -> void;
+auto test_parse_memo() -> void;
+auto test_parse_rule() -> void;
+auto test_parse_stream() -> void;
+auto test_parse_parallel_repeat() -> void;
+auto test_parse_errors() -> void;
+auto test_parse_named() -> void;
+auto test_parse_expect() -> void;
+auto test_parse_any_parser() -> void;
+auto test_parse_seq() -> void;
+auto test_parse_choice() -> void;
+auto test_parse_recognize() -> void;
 
 }  // namespace tmine_test
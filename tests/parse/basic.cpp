@@ -1,3 +1,7 @@
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <comb/file.hpp>
 #include "../assert.hpp"
 #include "../parse.hpp"
 
@@ -76,6 +80,63 @@ auto test_parse_integer() -> void {
     comb_assert_eq(result4.tail, "");
 }
 
+auto test_parse_integer_types() -> void {
+    comb_assert_eq(integer<int8_t>().parse("127").get_value(), 127);
+    comb_assert_eq(integer<int8_t>().parse("-128").get_value(), -128);
+    comb_assert(!integer<int8_t>().parse("128").ok());
+    comb_assert(!integer<int8_t>().parse("-129").ok());
+
+    comb_assert_eq(integer<uint8_t>().parse("+255").get_value(), 255);
+    comb_assert(!integer<uint8_t>().parse("256").ok());
+    comb_assert(!integer<uint8_t>().parse("-1").ok());
+
+    comb_assert_eq(
+        integer<uint64_t>().parse("18446744073709551615").get_value(),
+        std::numeric_limits<uint64_t>::max()
+    );
+    comb_assert(!integer<uint64_t>().parse("18446744073709551616").ok());
+    comb_assert_eq(
+        integer<int64_t>().parse("-9223372036854775808").get_value(),
+        std::numeric_limits<int64_t>::min()
+    );
+    comb_assert(!integer().parse("9223372036854775808").ok());
+
+    auto const result1 = integer().parse("12345678901234567x");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), 12345678901234567);
+    comb_assert_eq(result1.tail, "x");
+
+    auto const result2 = integer().parse("1234567x9012");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value(), 1234567);
+    comb_assert_eq(result2.tail, "x9012");
+
+    // the view ends before the rest of the digits
+    auto const digits = std::string_view{"123456789012"};
+    auto const result3 = integer().parse(digits.substr(0, 9));
+
+    comb_assert(result3.ok());
+    comb_assert_eq(result3.get_value(), 123456789);
+    comb_assert_eq(result3.tail, "");
+
+    auto const result4 = integer<uint32_t>(16).parse("fFz");
+
+    comb_assert(result4.ok());
+    comb_assert_eq(result4.get_value(), 255);
+    comb_assert_eq(result4.tail, "z");
+
+    auto const result5 = integer<int32_t>(2).parse("-1012");
+
+    comb_assert(result5.ok());
+    comb_assert_eq(result5.get_value(), -5);
+    comb_assert_eq(result5.tail, "2");
+
+    comb_assert(!integer().parse("-").ok());
+    comb_assert(!integer().parse(" 1").ok());
+}
+
 auto test_parse_whitespaces() -> void {
     auto const result1 = whitespace().parse("  \t\nName");
 
@@ -104,6 +165,38 @@ auto test_parse_whitespaces() -> void {
     comb_assert_eq(result5.tail, "Number");
 }
 
+auto test_parse_whitespaces_long() -> void {
+    auto constexpr SPACES = std::string_view{" \t\n\v\f\r"};
+    auto constexpr NOT_SPACES = std::string_view{"x\x08\x0E\x1F!\x85\xA0"};
+
+    for (auto n_spaces = size_t{0}; n_spaces < 200; ++n_spaces) {
+        for (auto stop : NOT_SPACES) {
+            auto src = std::string{};
+
+            for (auto i = size_t{0}; i < n_spaces; ++i) {
+                src += SPACES[i * 7 % SPACES.size()];
+            }
+
+            src += stop;
+            src += "   ";
+
+            auto const result = whitespace().parse(src);
+
+            comb_assert(result.ok());
+            comb_assert_eq(result.get_value().size(), n_spaces);
+            comb_assert_eq(result.tail.size(), 4);
+            comb_assert_eq(scan::count_whitespace_scalar(src), n_spaces);
+        }
+    }
+
+    auto const spaces_only = std::string(100, ' ');
+    auto const result = whitespace(100).parse(spaces_only);
+
+    comb_assert(result.ok());
+    comb_assert_eq(result.tail, "");
+    comb_assert(!whitespace(101).parse(spaces_only).ok());
+}
+
 auto test_parse_newline() -> void {
     auto const result1 = newline().parse("\nNew line");
 
@@ -118,4 +211,107 @@ auto test_parse_newline() -> void {
     comb_assert_eq(result2.tail, "New line");
 }
 
+auto test_parse_file() -> void {
+    auto const path =
+        std::filesystem::temp_directory_path() / "comb_test_parse_file.txt";
+    auto constexpr SOURCE = std::string_view{"name = 'John'\nname = 'Amy'\n"};
+
+    auto const file = std::fopen(path.c_str(), "wb");
+    comb_assert(nullptr != file);
+    std::fwrite(SOURCE.data(), 1, SOURCE.size(), file);
+    std::fclose(file);
+
+    auto const parser = list(
+        prefix("name = ") >> quoted_string('\''), newline(),
+        TrailingSeparator::Allowed
+    );
+
+    auto parsed = parse_file(path, parser);
+
+    comb_assert(parsed.has_value());
+    comb_assert(parsed->result.ok());
+    comb_assert_eq(parsed->input.view(), SOURCE);
+    comb_assert_eq(parsed->result.get_value().size(), 2);
+
+    // moving the input keeps views into it valid
+    auto const input = std::move(parsed->input);
+    auto const name = parsed->result.get_value()[1];
+
+    comb_assert_eq(name, "Amy");
+    comb_assert(input.view().data() < name.data());
+    comb_assert(name.data() < input.view().data() + input.view().size());
+
+    std::filesystem::remove(path);
+
+    comb_assert(!parse_file(path, parser).has_value());
+    comb_assert(!MappedInput::open(path).has_value());
+}
+
+auto test_parse_literals() -> void {
+    auto const result1 = prefix<"null">().parse("null, 1");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), "null");
+    comb_assert_eq(result1.tail, ", 1");
+    comb_assert(!prefix<"null">().parse("nul").ok());
+    comb_assert(!prefix<"null">().parse("nulL").ok());
+    comb_assert(prefix<"">().parse("").ok());
+
+    auto const result2 = (character<'{'>() >> character<'}'>()).parse("{}x");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value(), '}');
+    comb_assert_eq(result2.tail, "x");
+    comb_assert(!character<'{'>().parse("").ok());
+    comb_assert(!character<'{'>().parse("}").ok());
+
+    static_assert(prefix<"true">().parse("true").ok());
+    static_assert(!character<'a'>().parse("b").ok());
+}
+
+auto test_parse_char_class() -> void {
+    auto const identifier = one_of(char_class::alpha | CharClass::of("_")) &
+                            take_while(char_class::word);
+
+    auto const result1 = identifier.parse("snake_case_42 = 1");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value().first, 's');
+    comb_assert_eq(result1.get_value().second, "nake_case_42");
+    comb_assert_eq(result1.tail, " = 1");
+    comb_assert(!identifier.parse("42").ok());
+
+    auto const long_run = std::string(100, 'f') + "g";
+    auto const result2 = take_while(char_class::hex_digit, 1).parse(long_run);
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value().size(), 100);
+    comb_assert_eq(result2.tail, "g");
+
+    auto const result3 = take_while(char_class::digit, 2, 3).parse("12345");
+
+    comb_assert_eq(result3.get_value(), "123");
+    comb_assert_eq(result3.tail, "45");
+    comb_assert(!take_while(char_class::digit, 2).parse("1x").ok());
+
+    auto const high = CharClass::range('\x80', '\xFF');
+    auto const utf8 = std::string(40, '\xC3') + "a";
+
+    comb_assert_eq(take_while(high).parse(utf8).get_value().size(), 40);
+    comb_assert_eq(take_while(~high).parse(utf8).get_value().size(), 0);
+
+    comb_assert_eq(one_of("+-").parse("-1").get_value(), '-');
+    comb_assert(!one_of("+-").parse("1").ok());
+    comb_assert_eq(none_of("\"\\").parse("a").get_value(), 'a');
+    comb_assert(!none_of("\"\\").parse("\\").ok());
+
+    static_assert(char_class::word.contains('_'));
+    static_assert(!char_class::alnum.contains('_'));
+    static_assert(take_while(char_class::space).parse(" \t x").tail == "x");
+
+    // `'0'` is 0x30 and `'9'` is 0x39, both in the high nibble row 3
+    static_assert(scan::ClassTable{char_class::digit}.low[0] == 1 << 3);
+    static_assert(scan::ClassTable{char_class::digit}.low[10] == 0);
+}
+
 }  // namespace comb_test
@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+#include <fmt/ranges.h>
 #include "../json.hpp"
 #include "../parse.hpp"
 #include "../assert.hpp"
@@ -40,6 +43,156 @@ auto test_parse_json_object() -> void {
 
     comb_assert_eq(name, "Bob");
     comb_assert_eq(money, 42);
+
+    comb_assert(json::validate("{ \"name\": \"Bob\", \"tags\": [1, [2]] }"));
+    comb_assert(!json::validate("{ \"name\": \"Bob\", }"));
+}
+
+auto test_parse_json_tape() -> void {
+    auto constexpr SOURCE = std::string_view{
+        "{ \"name\": \"B\\\"ob\", \"tags\": [1, -2.5, true, null, []],\n"
+        "  \"nested\": { \"x\": 10 } } tail"
+    };
+
+    auto tape = json::Tape{};
+    auto result = json::parse_tape(SOURCE, tape);
+
+    comb_assert(result.ok());
+    comb_assert_eq(result.tail, "tail");
+    // two words for each of the 14 `[{,:` and the root
+    comb_assert(tape.words.capacity() <= 30);
+
+    auto const root = result.get_value();
+
+    comb_assert(json::TapeTag::ObjectBegin == root.tag());
+    comb_assert_eq(root.size(), 3);
+    comb_assert_eq(root.next_index(), tape.words.size());
+
+    auto const name = root.find("name");
+
+    comb_assert(name.has_value());
+    comb_assert_eq(name->get_string(), "B\\\"ob");
+    comb_assert(name->has_escapes());
+
+    auto const tags = root.find("tags");
+
+    comb_assert(tags.has_value());
+    comb_assert_eq(tags->size(), 5);
+
+    auto tag = tags->elements().begin();
+
+    comb_assert_eq((*tag++).get_integer(), 1);
+    comb_assert_eq((*tag++).get_float(), -2.5);
+    comb_assert((*tag++).get_bool());
+    comb_assert(json::TapeTag::Null == (*tag++).tag());
+    comb_assert_eq((*tag).size(), 0);
+    comb_assert(++tag == tags->elements().end());
+
+    auto const x = root.find("nested").value().find("x");
+
+    comb_assert(x.has_value());
+    comb_assert_eq(x->get_integer(), 10);
+    comb_assert(!root.find("missing").has_value());
+
+    auto n_members = size_t{0};
+
+    for (auto const member : root.members()) {
+        comb_assert(!member.key.empty());
+        n_members += 1;
+    }
+
+    comb_assert_eq(n_members, 3);
+
+    comb_assert(!json::parse_tape("[1, 2,]", tape).ok());
+    comb_assert(!json::parse_tape("{\"a\" 1}", tape).ok());
+    comb_assert(!json::parse_tape("[1", tape).ok());
+    comb_assert(!json::parse_tape(std::string(2000, '['), tape).ok());
+    comb_assert(json::parse_tape("1", tape).ok());
+    comb_assert_eq(tape.words.size(), 2);
+
+    // leading zeros are not allowed
+    comb_assert(!json::parse_tape("01", tape).ok());
+    comb_assert(!json::parse_tape("-01", tape).ok());
+    comb_assert(!json::parse_tape("[1, 00]", tape).ok());
+    comb_assert(!json::parse_tape("-", tape).ok());
+    comb_assert(json::parse_tape("0", tape).ok());
+    comb_assert_eq(json::parse_tape("-0 1", tape).tail, "1");
+    comb_assert_eq(json::parse_tape("0.5", tape).get_value().get_float(), 0.5);
+    comb_assert_eq(json::parse_tape("-0e1", tape).tail, "");
+}
+
+auto test_parse_json_events() -> void {
+    struct Recorder {
+        std::vector<std::string> events;
+
+        auto on_null() -> void {
+            this->events.push_back("null");
+        }
+
+        auto on_bool(bool value) -> void {
+            this->events.push_back(fmt::format("{}", value));
+        }
+
+        auto on_integer(int64_t value) -> void {
+            this->events.push_back(fmt::format("{}", value));
+        }
+
+        auto on_float(double value) -> void {
+            this->events.push_back(fmt::format("{:.1f}", value));
+        }
+
+        auto on_string(EscapedString string) -> void {
+            this->events.push_back(fmt::format("'{}'", string.raw));
+        }
+
+        auto on_key(EscapedString string) -> void {
+            this->events.push_back(fmt::format("{}:", string.raw));
+        }
+
+        auto on_list_begin() -> void {
+            this->events.push_back("[");
+        }
+
+        auto on_list_end(size_t count) -> void {
+            this->events.push_back(fmt::format("]{}", count));
+        }
+
+        auto on_object_begin() -> void {
+            this->events.push_back("{");
+        }
+
+        auto on_object_end(size_t count) -> void {
+            this->events.push_back(fmt::format("}}{}", count));
+        }
+    };
+
+    auto recorder = Recorder{};
+    auto result = json::parse_events(
+        " {\"a\": [1, 2.5, \"s\"], \"b\": {\"c\": null, \"d\": false}} ,",
+        recorder
+    );
+
+    comb_assert(result.ok());
+    comb_assert_eq(result.get_value().front(), '{');
+    comb_assert_eq(result.get_value().back(), '}');
+    comb_assert_eq(result.tail, ",");
+    comb_assert_eq(
+        fmt::format("{}", fmt::join(recorder.events, " ")),
+        "{ a: [ 1 2.5 's' ]3 b: { c: null d: false }2 }2"
+    );
+
+    auto lines = Recorder{};
+    auto const values = list(json::events(lines), character(','));
+    auto result2 = values("1, [true] ,\"x\"");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value().size(), 3);
+    comb_assert_eq(
+        fmt::format("{}", fmt::join(lines.events, " ")), "1 [ true ]1 'x'"
+    );
+
+    comb_assert(!json::parse_events("[1, }", recorder).ok());
+    comb_assert(!json::parse_events("{\"a\": -012}", recorder).ok());
 }
 
 }
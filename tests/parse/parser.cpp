@@ -1,4 +1,10 @@
+#include <array>
+#include <atomic>
+#include <memory_resource>
+#include <random>
 #include <fmt/ranges.h>
+#include <comb/parallel.hpp>
+#include <comb/profile.hpp>
 #include "../assert.hpp"
 #include "../parse.hpp"
 
@@ -62,6 +68,59 @@ auto test_parse_quoted_string() -> void {
     comb_assert_eq(result4.tail, "String!");
 }
 
+auto test_parse_escaped_string() -> void {
+    auto const result1 = escaped_string().parse("\"plain\"tail");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value().raw, "plain");
+    comb_assert(!result1.get_value().has_escapes);
+    comb_assert_eq(result1.tail, "tail");
+
+    auto const result2 = escaped_string().parse(R"("a\"b\\c\n"tail)");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value().raw, R"(a\"b\\c\n)");
+    comb_assert(result2.get_value().has_escapes);
+    comb_assert_eq(result2.tail, "tail");
+
+    auto buffer = std::string(result2.get_value().raw.size(), '\0');
+    auto const decoded2 = result2.get_value().unescape(buffer.data());
+
+    comb_assert(decoded2.has_value());
+    comb_assert_eq(*decoded2, "a\"b\\c\n");
+
+    auto const result3 = escaped_string().parse(R"("\u00e9\ud83d\ude00!")");
+    buffer.resize(result3.get_value().raw.size());
+    auto const decoded3 = result3.get_value().unescape(buffer.data());
+
+    comb_assert(decoded3.has_value());
+    comb_assert_eq(*decoded3, "\xC3\xA9\xF0\x9F\x98\x80!");
+
+    comb_assert(!escaped_string().parse(R"("unterminated\")").ok());
+    comb_assert(!escaped_string().parse(R"("unterminated\)").ok());
+
+    auto const long_string = "\"" + std::string(100, 'x') + "\\\"" +
+                             std::string(40, 'y') + "\"tail";
+    auto const result4 = escaped_string().parse(long_string);
+
+    comb_assert(result4.ok());
+    comb_assert_eq(result4.get_value().raw.size(), 142);
+    comb_assert_eq(result4.tail, "tail");
+
+    auto const result5 = escaped_string('\'').parse(R"('it\'s'tail)");
+
+    comb_assert(result5.ok());
+    comb_assert_eq(result5.get_value().raw, R"(it\'s)");
+
+    buffer.resize(16);
+    comb_assert(!(EscapedString{.raw = R"(\q)", .has_escapes = true}
+                      .unescape(buffer.data())
+                      .has_value()));
+    comb_assert(!(EscapedString{.raw = R"(\udc00)", .has_escapes = true}
+                      .unescape(buffer.data())
+                      .has_value()));
+}
+
 auto test_parse_parser_left_right() -> void {
     auto parser = character('<') >> prefix("value") << character('>');
 
@@ -110,6 +169,59 @@ auto test_parse_parser_map() -> void {
     comb_assert_eq(result3.tail, "_tail");
 }
 
+auto test_parse_keywords() -> void {
+    auto constexpr parser = keywords<int>({
+        {"in", 1},
+        {"integer", 3},
+        {"int", 2},
+        {"if", 4},
+        {"else", 5},
+    });
+
+    static_assert(parser.parse("integral").get_value() == 2);
+
+    auto result1 = parser.parse("integer x");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), 3);
+    comb_assert_eq(result1.tail, " x");
+
+    auto result2 = parser.parse("intx");
+
+    comb_assert_eq(result2.get_value(), 2);
+    comb_assert_eq(result2.tail, "x");
+
+    auto result3 = parser.parse("elsewhere");
+
+    comb_assert_eq(result3.get_value(), 5);
+    comb_assert_eq(result3.tail, "where");
+
+    comb_assert_eq(parser.parse("if").get_value(), 4);
+    comb_assert(!parser.parse("i").ok());
+    comb_assert(!parser.parse("").ok());
+    comb_assert(!parser.parse("then").ok());
+
+    auto with_default = keywords<std::string_view>({
+        {"yes", "y"},
+        {"", "?"},
+    });
+
+    comb_assert_eq(with_default.parse("yes").get_value(), "y");
+    comb_assert_eq(with_default.parse("no").get_value(), "?");
+    comb_assert_eq(with_default.parse("no").tail, "no");
+
+    auto constexpr duplicates = keywords<int>({
+        {"on", 1},
+        {"off", 2},
+        {"on", 3},
+        {"", 4},
+        {"", 5},
+    });
+
+    static_assert(duplicates.parse("on").get_value() == 1);
+    static_assert(duplicates.parse("x").get_value() == 4);
+}
+
 auto test_parse_parser_vector_sequence() -> void {
     auto parser = (character('a') | character('b')).repeat();
 
@@ -122,6 +234,62 @@ auto test_parse_parser_vector_sequence() -> void {
     comb_assert_eq(result.tail, "caba");
 }
 
+auto test_parse_fold() -> void {
+    auto sum = (integer() << whitespace())
+                   .repeat_fold(int64_t{0}, std::plus<int64_t>{}, 1);
+
+    auto result1 = sum("1 2 3 4 tail");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), 10);
+    comb_assert_eq(result1.tail, "tail");
+    comb_assert(!sum("tail").ok());
+
+    auto count = character('a').count(2);
+
+    comb_assert_eq(count("aaab").get_value(), 3);
+    comb_assert(!count("ab").ok());
+
+    auto skip = (character('a') | character('b')).skip_many();
+    auto result2 = skip("abbac");
+
+    comb_assert_eq(result2.get_value(), "abba");
+    comb_assert_eq(result2.tail, "c");
+
+    auto seen = std::vector<std::string_view>{};
+    auto for_each = prefix("x").repeat_for_each([&seen](auto value) {
+        seen.push_back(value);
+    });
+
+    comb_assert_eq(for_each("xxy").get_value(), 2);
+    comb_assert_eq(seen.size(), 2);
+
+    auto list_sum = list_fold(
+        integer(), whitespace() >> character(',') << whitespace(), int64_t{0},
+        std::plus<int64_t>{}, TrailingSeparator::Required
+    );
+
+    auto result3 = list_sum("1, 2, 3 , 4 tail");
+
+    comb_assert(result3.ok());
+    comb_assert_eq(result3.get_value(), 6);
+    comb_assert_eq(result3.tail, "4 tail");
+
+    auto n_elems = size_t{0};
+    auto list_count = list_for_each(
+        quoted_string('\''), character(','),
+        [&n_elems](std::string_view) { n_elems += 1; },
+        TrailingSeparator::Disallowed, 1
+    );
+
+    auto result4 = list_count("'a','b','c',");
+
+    comb_assert(result4.ok());
+    comb_assert_eq(result4.get_value(), 3);
+    comb_assert_eq(result4.tail, ",");
+    comb_assert_eq(n_elems, 3);
+}
+
 auto test_parse_opt() -> void {
     auto parser = prefix("value") >> character('=') >> integer().opt();
 
@@ -184,6 +352,42 @@ auto test_parse_list() -> void {
     comb_assert_eq(result4.tail, "");
 }
 
+auto test_parse_list_allocator() -> void {
+    auto buffer = std::array<std::byte, 4096>{};
+    auto arena = std::pmr::monotonic_buffer_resource{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()
+    };
+
+    auto parse1 = list(
+        integer(), character(','), TrailingSeparator::Allowed, 0, &arena
+    );
+    auto result1 = parse1("1,2,3,4,5tail");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(
+        result1.get_value(), (std::pmr::vector<int64_t>{1, 2, 3, 4, 5})
+    );
+    comb_assert(&arena == result1.value->get_allocator().resource());
+    comb_assert_eq(result1.tail, "tail");
+
+    auto parse2 = (character('a') | character('b')).repeat(1, &arena);
+    auto result2 = parse2("abbac");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(
+        result2.get_value(), (std::pmr::vector<char>{'a', 'b', 'b', 'a'})
+    );
+    comb_assert_eq(result2.tail, "c");
+    comb_assert(!parse2("c").ok());
+
+    auto parse3 =
+        prefix("x").repeat(0, std::pmr::polymorphic_allocator<>{&arena});
+    auto result3 = parse3("xxx");
+
+    comb_assert_eq(result3.get_value().size(), 3);
+    comb_assert(&arena == result3.value->get_allocator().resource());
+}
+
 auto test_parse_list_disallowed_trailing_sep() -> void {
     auto parser = list(
         integer(), whitespace() >> character(',') << whitespace(),
@@ -318,6 +522,94 @@ auto test_parse_float() -> void {
     comb_assert_eq(result1.tail, "");
 }
 
+auto test_parse_float_formats() -> void {
+    auto const general = floating();
+    auto const json = floating(FloatFormat::Json);
+
+    comb_assert_eq(general.parse("1.").get_value(), 1.0);
+    comb_assert_eq(general.parse(".5").get_value(), 0.5);
+    comb_assert_eq(general.parse("+2.5e-1").get_value(), 0.25);
+    comb_assert(std::isinf(general.parse("-inf").get_value()));
+    comb_assert(!general.parse(".").ok());
+    comb_assert(!general.parse("e5").ok());
+    comb_assert(std::isinf(general.parse("+inf").get_value()));
+    comb_assert(!general.parse("+-5").ok());
+    comb_assert(!general.parse("+-inf").ok());
+    comb_assert(!general.parse("++5").ok());
+    comb_assert_eq(general.parse("+-5").tail, "+-5");
+
+    auto const result1 = json.parse("01");
+
+    comb_assert_eq(result1.get_value(), 0.0);
+    comb_assert_eq(result1.tail, "1");
+
+    auto const result2 = json.parse("1.e5");
+
+    comb_assert_eq(result2.get_value(), 1.0);
+    comb_assert_eq(result2.tail, ".e5");
+
+    auto const result3 = json.parse("-0.5E+2,");
+
+    comb_assert_eq(result3.get_value(), -50.0);
+    comb_assert_eq(result3.tail, ",");
+
+    comb_assert(!json.parse(".5").ok());
+    comb_assert(!json.parse("+1").ok());
+    comb_assert(!json.parse("inf").ok());
+
+    auto const result4 = general.parse("1e");
+
+    comb_assert_eq(result4.get_value(), 1.0);
+    comb_assert_eq(result4.tail, "e");
+
+    // the view ends in the middle of the number
+    auto const digits = std::string_view{"1.2567"};
+    auto const result5 = general.parse(digits.substr(0, 4));
+
+    comb_assert_eq(result5.get_value(), 1.25);
+    comb_assert_eq(result5.tail, "");
+
+    comb_assert_eq(
+        general.parse("123456789012345678901234").get_value(),
+        123456789012345678901234.0
+    );
+    comb_assert_eq(
+        general.parse("0.000000000000000000000000000001").get_value(), 1e-30
+    );
+    comb_assert(!general.parse("1e400").ok());
+    comb_assert_eq(floating<float>().parse("0.1").get_value(), 0.1f);
+    comb_assert_eq(
+        floating<float>().parse("16777217").get_value(), 16777216.0f
+    );
+    comb_assert_eq(floating<long double>().parse("0.5").get_value(), 0.5L);
+    comb_assert_eq(floating<long double>().parse("-0").get_value(), 0.0L);
+    comb_assert_eq(floating<long double>().parse("0.1").get_value(), 0.1L);
+
+    auto random = std::mt19937_64{42};
+
+    for (auto i = 0; i < 10'000; ++i) {
+        auto const bits = random();
+        auto value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (!std::isfinite(value)) {
+            continue;
+        }
+
+        auto const text = fmt::format("{}", value);
+        auto const result = general.parse(text);
+
+        comb_assert(result.ok());
+        comb_assert_eq(result.get_value(), value);
+        comb_assert_eq(result.tail, "");
+
+        auto const short_value = (double) (random() % 100'000'000) / 1000.0;
+        auto const short_text = fmt::format("{:.3f}", short_value);
+
+        comb_assert_eq(json.parse(short_text).get_value(), short_value);
+    }
+}
+
 auto test_parse_collect() -> void {
     using Card = struct {
         std::string name;
@@ -344,6 +636,11 @@ auto test_parse_collect() -> void {
     auto result2 = parse("  'George' 180.1 42");
 
     comb_assert(!result2.ok());
+
+    auto result3 = parse("'George' tall 42");
+
+    comb_assert(!result3.ok());
+    comb_assert_eq(result3.tail, "'George' tall 42");
 }
 
 auto test_parse_end() -> void {
@@ -360,4 +657,615 @@ auto test_parse_end() -> void {
     comb_assert(!result2.ok());
 }
 
+auto test_parse_memo() -> void {
+    auto n_calls = size_t{0};
+
+    auto counted = Parser{[&n_calls](std::string_view src) {
+        n_calls += 1;
+        return integer().parse(src);
+    }};
+
+    auto number = std::move(counted).memo();
+
+    static_assert(std::same_as<decltype(number)::ParseValue, int64_t>);
+    auto parse = (number << character('a')) | (number << character('b')) |
+                 (number << character('c'));
+
+    auto table = MemoTable{};
+    auto result1 = table.parse(parse, "42c");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), 42);
+    comb_assert_eq(result1.tail, "");
+    comb_assert_eq(n_calls, 1);
+
+    auto result2 = table.parse(parse, "17c");
+
+    comb_assert(result2.ok());
+    comb_assert_eq(result2.get_value(), 17);
+    comb_assert_eq(n_calls, 2);
+
+    table.clear();
+
+    n_calls = 0;
+    auto result3 = parse("42c");
+
+    comb_assert(result3.ok());
+    comb_assert_eq(n_calls, 3);
+
+    n_calls = 0;
+    auto bounded = MemoTable{0};
+    auto result4 = bounded.parse(parse, "42c");
+
+    comb_assert(result4.ok());
+    comb_assert_eq(result4.get_value(), 42);
+    comb_assert_eq(n_calls, 3);
+}
+
+auto test_parse_rule() -> void {
+    auto parens = recursive<size_t>([](ParserLike auto self) {
+        return (character('(') >> std::move(self).opt() << character(')'))
+            .map([](auto depth) { return 1 + depth.value_or(0); });
+    });
+
+    auto result1 = parens.parse("((()))tail");
+
+    comb_assert(result1.ok());
+    comb_assert_eq(result1.get_value(), 3);
+    comb_assert_eq(result1.tail, "tail");
+
+    auto result2 = (parens.ref() << end()).parse("(()");
+
+    comb_assert(!result2.ok());
+
+    auto copy = parens;
+    auto result3 = copy("()");
+
+    comb_assert(result3.ok());
+    comb_assert_eq(result3.get_value(), 1);
+}
+
+auto test_parse_stream() -> void {
+    auto constexpr SOURCE = std::string_view{"12;345;6789;0;42;"};
+
+    for (auto chunk_size : {1uz, 2uz, 3uz, 5uz, SOURCE.size()}) {
+        auto stream = stream_parser(integer() << character(';'));
+        auto values = std::vector<int64_t>{};
+        auto const sink = [&values](int64_t value) { values.push_back(value); };
+
+        for (auto i = size_t{0}; i < SOURCE.size(); i += chunk_size) {
+            auto const status = stream.feed(SOURCE.substr(i, chunk_size), sink);
+
+            comb_assert(StreamStatus::NeedMoreInput == status);
+            comb_assert(stream.pending().size() <= 5);
+        }
+
+        comb_assert_eq(values, (std::vector<int64_t>{12, 345, 6789, 0}));
+        comb_assert(StreamStatus::Done == stream.finish(sink));
+        comb_assert_eq(values, (std::vector<int64_t>{12, 345, 6789, 0, 42}));
+    }
+
+    auto const ignore = [](auto) {};
+
+    auto invalid = stream_parser(integer() << character(';'));
+
+    comb_assert(StreamStatus::NeedMoreInput == invalid.feed("1;x;", ignore));
+    comb_assert_eq(invalid.pending(), "x;");
+    comb_assert(StreamStatus::Error == invalid.finish(ignore));
+
+    auto oversized = stream_parser(integer() << character(';'), 4);
+
+    comb_assert(StreamStatus::NeedMoreInput == oversized.feed("1234", ignore));
+    comb_assert(StreamStatus::Error == oversized.feed("5", ignore));
+
+    // a large record fed in small chunks is not parsed again on every chunk
+    auto n_attempts = size_t{0};
+    auto const record = take_while(char_class::alpha) << character(';');
+    auto large = stream_parser(Parser{[&](std::string_view src) {
+        n_attempts += 1;
+        return record(src);
+    }});
+    auto const chunk = std::string(16, 'a');
+    auto n_records = size_t{0};
+    auto const count = [&n_records](auto) { n_records += 1; };
+
+    for (auto i = size_t{0}; i < 4096; ++i) {
+        comb_assert(StreamStatus::NeedMoreInput == large.feed(chunk, count));
+    }
+
+    comb_assert(StreamStatus::NeedMoreInput == large.feed(";b;", count));
+    comb_assert(StreamStatus::Done == large.finish(count));
+    comb_assert_eq(n_records, 2);
+    comb_assert(n_attempts < 300);
+
+    // complete records are parsed before the pending input counts as too
+    // large, even between doublings
+    auto const near_cap =
+        std::string(40000, 'a') + ";" + std::string(30000, 'a') + ";";
+    auto capped = stream_parser(record, 50000);
+
+    n_records = 0;
+
+    for (auto i = size_t{0}; i < near_cap.size(); i += 16) {
+        comb_assert(
+            StreamStatus::NeedMoreInput ==
+            capped.feed(std::string_view{near_cap}.substr(i, 16), count)
+        );
+    }
+
+    comb_assert_eq(n_records, 1);
+    comb_assert(StreamStatus::Done == capped.finish(count));
+    comb_assert_eq(n_records, 2);
+
+    // a chunk with the terminator is retried right away
+    auto live = stream_parser(record, 1 << 20, ';');
+
+    n_records = 0;
+
+    for (auto i = size_t{0}; i < 4096; ++i) {
+        comb_assert(StreamStatus::NeedMoreInput == live.feed(chunk, count));
+    }
+
+    comb_assert(StreamStatus::NeedMoreInput == live.feed(";b", count));
+    comb_assert_eq(n_records, 1);
+    comb_assert_eq(live.pending(), "b");
+
+    // a malformed record followed by its terminator fails right away
+    auto malformed = stream_parser(integer() << character(';'), 1 << 20, ';');
+
+    comb_assert(StreamStatus::Error == malformed.feed("1;x;2;", ignore));
+
+    // without a terminator an optional tail depends on the chunk split
+    auto const optional_tail = prefix("ab") >> prefix("cd").opt();
+    auto split = stream_parser(optional_tail);
+    auto whole = stream_parser(optional_tail);
+
+    n_records = 0;
+
+    comb_assert(StreamStatus::NeedMoreInput == split.feed("abc", count));
+    comb_assert_eq(n_records, 1);
+    comb_assert(StreamStatus::NeedMoreInput == split.feed("d", count));
+    comb_assert(StreamStatus::Error == split.finish(count));
+
+    n_records = 0;
+
+    comb_assert(StreamStatus::NeedMoreInput == whole.feed("abcd", count));
+    comb_assert(StreamStatus::Done == whole.finish(count));
+    comb_assert_eq(n_records, 1);
+
+    // a terminator makes it independent of the split
+    auto terminated =
+        stream_parser(optional_tail << character(';'), 1 << 20, ';');
+
+    n_records = 0;
+
+    comb_assert(StreamStatus::NeedMoreInput == terminated.feed("abc", count));
+    comb_assert_eq(n_records, 0);
+    comb_assert(StreamStatus::NeedMoreInput == terminated.feed("d;", count));
+    comb_assert_eq(n_records, 1);
+    comb_assert_eq(terminated.pending(), "");
+}
+
+auto test_parse_errors() -> void {
+    auto const separator = character(',') << whitespace();
+    auto const parser =
+        list(integer(), separator, TrailingSeparator::Disallowed, 1) << end();
+
+    auto result1 = parse(parser, "1,2");
+
+    static_assert(
+        std::same_as<decltype(result1), ParseResult<std::vector<int64_t>>>
+    );
+    comb_assert(result1.ok());
+
+#ifndef COMB_NO_ERROR_TRACKING
+    auto constexpr SOURCE = std::string_view{"1,2,\n3,x"};
+    auto report1 = parse<FurthestFailure>(parser, SOURCE);
+
+    comb_assert(!report1.result.ok());
+    comb_assert(report1.error.has_value());
+    comb_assert_eq(report1.error->offset, 7);
+    comb_assert(
+        (SourceLocation{.line = 2, .column = 3}) ==
+        report1.error->location(SOURCE)
+    );
+    comb_assert_eq(report1.error->expected.size(), 1);
+    comb_assert_eq(report1.error->expected[0].name, "integer");
+
+    auto const boolean = prefix("true") | prefix("false");
+    auto report2 = parse<FurthestFailure>(boolean >> end(), "fals");
+
+    comb_assert(!report2.result.ok());
+    comb_assert_eq(report2.error->offset, 0);
+    comb_assert_eq(report2.error->expected.size(), 2);
+    comb_assert_eq(report2.error->expected[1].literal, "false");
+
+    auto report3 = parse<FurthestFailure>(boolean, "true");
+
+    comb_assert(report3.result.ok());
+    comb_assert(!report3.error.has_value());
+
+    auto report4 = parse<FurthestFailure>(quoted_string(), "\"abc");
+
+    comb_assert_eq(report4.error->offset, 4);
+    comb_assert_eq(report4.error->expected[0].name, "closing quote");
+
+    // the tag reaches leaves behind erased parsers and rules
+    auto const erased = erase(integer() << character(';'));
+    auto const rule = recursive<int64_t>([&erased](ParserLike auto) {
+        return erased;
+    });
+    auto report5 = parse<FurthestFailure>(rule.ref(), "12,");
+
+    comb_assert(report5.error.has_value());
+    comb_assert_eq(report5.error->offset, 2);
+    comb_assert_eq(report5.error->expected[0].literal, ";");
+
+    // a result cached without the tag is computed again to report it
+    auto const word = (integer() << character(';')).memo();
+    auto const untracked = Parser{[&word](std::string_view src) {
+        return word.parse(src);
+    }};
+    auto const grammar = (untracked << end()) | (word << end());
+    auto table = MemoTable{};
+    auto const memoized = Parser{
+        [&](std::string_view src, std::same_as<Track> auto... mode) {
+            return table.parse(grammar, src, mode...);
+        }
+    };
+    auto report6 = parse<FurthestFailure>(memoized, "12,");
+
+    comb_assert(!report6.result.ok());
+    comb_assert(report6.error.has_value());
+    comb_assert_eq(report6.error->offset, 2);
+#else
+    // failures are not reported at all
+    auto report = parse<FurthestFailure>(parser, "1,x");
+
+    comb_assert(!report.result.ok());
+    comb_assert(!report.error.has_value());
+#endif
+}
+
+auto test_parse_parallel_repeat() -> void {
+    auto source = std::string{};
+
+    for (auto i = size_t{0}; source.size() < (1 << 20); ++i) {
+        source += fmt::format("name = 'value {}'\n", i);
+    }
+
+    auto const record = prefix("name = ") >> quoted_string('\'');
+    auto const sequential = list(record, character('\n'));
+    auto const parallel = parallel_repeat(record, '\n', 4);
+
+    auto result1 = parallel(source);
+    auto expected1 = sequential(source);
+
+    comb_assert(result1.ok());
+    comb_assert(result1.tail.empty());
+    comb_assert(result1.get_value() == expected1.get_value());
+
+    auto const error_offset = source.find('\n', source.size() / 3 * 2) + 1;
+    source[error_offset] = 'N';
+
+    auto result2 = parallel(source);
+    auto expected2 = sequential(source);
+
+    comb_assert(result2.get_value() == expected2.get_value());
+    comb_assert(result2.tail.data() == expected2.tail.data());
+    comb_assert(result2.tail.data() == source.data() + error_offset);
+
+#ifndef COMB_NO_ERROR_TRACKING
+    auto report = parse<FurthestFailure>(parallel, source);
+
+    comb_assert(report.error.has_value());
+    comb_assert_eq(report.error->offset, error_offset);
+#endif
+
+    // a committed failure in the first chunk stops the parse
+    auto const committed = parallel_repeat(
+        prefix("name = ") >> quoted_string('\'').expect(), '\n', 4
+    );
+    auto const quote_offset = source.find('\n', source.size() / 8) + 8;
+    source[quote_offset] = '"';
+
+    auto result3 = committed(source);
+
+    comb_assert(!result3.ok());
+    comb_assert(result3.committed);
+
+#ifndef COMB_NO_ERROR_TRACKING
+    auto report3 = parse<FurthestFailure>(committed, source);
+
+    comb_assert(report3.error.has_value());
+    comb_assert_eq(report3.error->offset, quote_offset);
+#endif
+
+    comb_assert(parallel("").ok());
+
+    // tasks may run batches of their own on the same pool
+    auto pool = ThreadPool{2};
+    auto sums = std::array<std::atomic<size_t>, 8>{};
+
+    pool.run(sums.size(), [&](size_t i) {
+        pool.run(i + 1, [&sums, i](size_t j) { sums[i] += j + 1; });
+    });
+
+    for (auto i = size_t{0}; i < sums.size(); ++i) {
+        comb_assert_eq(sums[i].load(), (i + 1) * (i + 2) / 2);
+    }
+
+#ifdef __cpp_exceptions
+    // a throwing task does not stop the others and rethrows on the caller
+    auto n_done = std::atomic<size_t>{0};
+    auto caught = false;
+
+    try {
+        pool.run(8, [&n_done](size_t i) {
+            if (3 == i) {
+                throw std::runtime_error("task 3");
+            }
+
+            n_done += 1;
+        });
+    } catch (std::runtime_error const& error) {
+        caught = std::string_view{"task 3"} == error.what();
+    }
+
+    comb_assert(caught);
+    comb_assert_eq(n_done.load(), size_t{7});
+#endif
+}
+
+auto test_parse_named() -> void {
+    auto const digits = named("digits", integer());
+    auto const pair = named(
+        "pair", (digits << character(',') & digits) |
+                    (digits << character(';') & digits)
+    );
+    auto const parser = character('(') >> pair;
+
+    auto result = parser("(12;3");
+
+    comb_assert(result.ok());
+    comb_assert_eq(result.get_value().second, 3);
+
+#ifdef COMB_PROFILE
+    auto stats = profile::snapshot();
+    auto const find = [&stats](std::string_view name) {
+        return *std::ranges::find(stats, name, &profile::RuleStats::name);
+    };
+
+    auto const digits_stats = find("digits");
+
+    // the first alternative fails after `12`, the second parses it again
+    comb_assert_eq(digits_stats.n_calls, 3);
+    comb_assert_eq(digits_stats.n_successes, 3);
+    comb_assert_eq(digits_stats.n_consumed, 5);
+    comb_assert_eq(digits_stats.n_rescanned, 2);
+    comb_assert_eq(find("pair").n_calls, 1);
+    comb_assert_eq(find("pair").n_consumed, 4);
+
+    profile::reset();
+
+    comb_assert_eq(profile::snapshot()[0].n_calls, 0);
+
+    // parsing the same buffer again is a new pass, not a rescan
+    auto const input = std::string_view{"(12;3"};
+
+    comb_assert(parser(input).ok());
+    comb_assert(parser(input).ok());
+
+    stats = profile::snapshot();
+
+    comb_assert_eq(find("digits").n_calls, 6);
+    comb_assert_eq(find("digits").n_rescanned, 4);
+#else
+    static_assert(std::same_as<decltype(digits), decltype(integer()) const>);
+    comb_assert(profile::snapshot().empty());
+#endif
+}
+
+auto test_parse_expect() -> void {
+    auto const call = character('(') >> (integer() << character(')')).expect();
+    auto const placeholder =
+        prefix("(x)").map([](auto) { return int64_t{-1}; });
+    auto const parser = call | placeholder;
+
+    comb_assert_eq(parser("(12)").get_value(), 12);
+
+    // `(` commits to `call`, so `placeholder` is not tried
+    auto const result = parser("(x)");
+
+    comb_assert(!result.ok());
+    comb_assert(result.committed);
+    comb_assert(!call.opt()("(x)").ok());
+    comb_assert(!call.repeat()("(1)(x)").ok());
+    comb_assert(!list(call, character(','))("(1),(x)").ok());
+
+    comb_assert_eq((attempt(call) | placeholder)("(x)").get_value(), -1);
+    comb_assert_eq(attempt(call).repeat()("(1)(x)").get_value().size(), 1);
+    comb_assert(!(character('[') >> call)("(1)").committed);
+}
+
+auto test_parse_any_parser() -> void {
+    auto const small = erase(integer());
+
+    comb_assert(small.parse.is_inline());
+    comb_assert_eq(small("42 tail").get_value(), 42);
+    comb_assert_eq(small("42 tail").tail, " tail");
+    comb_assert(!small("tail").ok());
+
+    auto const padding = std::array<char, 256>{};
+    auto const large = AnyParser<int64_t>{
+        integer().take_if([padding](int64_t value) {
+            return value != (int64_t) padding.size();
+        }),
+    };
+
+    comb_assert(!large.parse.is_inline());
+    comb_assert_eq(large("12").get_value(), 12);
+    comb_assert(!large("256").ok());
+
+    // alternatives chosen at runtime
+    auto alternatives = std::vector<AnyParser<int64_t>>{};
+    alternatives.push_back(small);
+    alternatives.push_back(large);
+    alternatives.push_back(erase(character('x').map([](char) {
+        return int64_t{-1};
+    })));
+
+    auto const first_match = [&](std::string_view src) {
+        for (auto const& alternative : alternatives) {
+            if (auto result = alternative(src); result.ok()) {
+                return result.get_value();
+            }
+        }
+
+        return int64_t{0};
+    };
+
+    comb_assert_eq(first_match("7"), 7);
+    comb_assert_eq(first_match("x"), -1);
+    comb_assert_eq(first_match("?"), 0);
+
+    // copies and moves keep the parser usable
+    auto copy = alternatives[1];
+    auto moved = std::move(alternatives[0]);
+    copy = moved;
+
+    comb_assert(copy.parse.is_inline());
+    comb_assert_eq(copy("5").get_value(), 5);
+
+    // erased parsers compose like any other parser
+    auto const pair = erase(small << character(',')) & large;
+    auto const [first, second] = pair("1,2").get_value();
+
+    comb_assert_eq(first, 1);
+    comb_assert_eq(second, 2);
+}
+
+auto test_parse_seq() -> void {
+    auto const assignment = seq<0, 4>(
+        take_while(char_class::alpha, 1), whitespace(), character('='),
+        whitespace(), integer()
+    );
+
+    auto const [name, value] = assignment("x = 42;").get_value();
+
+    comb_assert_eq(name, "x");
+    comb_assert_eq(value, 42);
+    comb_assert_eq(assignment("x = 42;").tail, ";");
+
+    auto const result = assignment("x = y");
+
+    comb_assert(!result.ok());
+    comb_assert_eq(result.tail, "x = y");
+
+    // a single index keeps the value itself
+    auto const quoted = seq<2>(prefix("name"), character('='), quoted_string());
+
+    comb_assert_eq(quoted("name=\"comb\"").get_value(), "comb");
+
+    // without indices every value is kept
+    auto const all = seq(character('('), integer(), character(')'));
+
+    auto const [open, number, close] = all("(7)").get_value();
+
+    comb_assert_eq(open, '(');
+    comb_assert_eq(number, 7);
+    comb_assert_eq(close, ')');
+
+    auto const committed = seq(character('('), integer().expect());
+
+    comb_assert(committed("(x").committed);
+}
+
+auto test_parse_choice() -> void {
+    auto const same = choice(prefix("get"), prefix("put"), prefix("post"));
+
+    comb_assert_eq(same("put /").get_value(), "put");
+    comb_assert_eq(same("post /").tail, " /");
+    comb_assert(!same("delete /").ok());
+    comb_assert_eq(same("delete /").tail, "delete /");
+
+    // different value types are returned as a variant
+    auto const mixed = choice(integer(), quoted_string(), character('-'));
+
+    comb_assert_eq(mixed("12").get_value().index(), 0);
+    comb_assert_eq(std::get<0>(mixed("12").get_value()), 12);
+    comb_assert_eq(std::get<1>(mixed("\"a\"").get_value()), "a");
+    comb_assert_eq(std::get<2>(mixed("-").get_value()), '-');
+    comb_assert(!mixed("x").ok());
+
+    // a committed failure stops the remaining alternatives
+    auto const call = choice(
+        character('(') >> (integer() << character(')')).expect(),
+        prefix("(x)").map([](auto) { return int64_t{-1}; })
+    );
+
+    comb_assert_eq(call("(3)").get_value(), 3);
+    comb_assert(!call("(x)").ok());
+    comb_assert(call("(x)").committed);
+}
+
+auto test_parse_recognize() -> void {
+    auto n_transforms = size_t{0};
+    auto const numbers = list(
+        integer().map([&n_transforms](int64_t value) {
+            n_transforms += 1;
+            return value * 2;
+        }),
+        character(',')
+    );
+
+    auto const result = recognize(numbers)("1,2,3;");
+
+    comb_assert_eq(result.get_value(), "1,2,3");
+    comb_assert_eq(result.tail, ";");
+    comb_assert_eq(n_transforms, 0);
+    comb_assert(!recognize(numbers)("x").ok());
+
+    // values are built as usual outside of `recognize`
+    comb_assert_eq(numbers("1,2").get_value().size(), 2);
+    comb_assert_eq(n_transforms, 2);
+
+    // `take_if` still sees the real values
+    auto const pair = numbers.take_if([](auto const& values) {
+        return 2 == values.size();
+    });
+
+    comb_assert_eq(recognize(pair)("1,2").get_value(), "1,2");
+    comb_assert(!recognize(pair)("1,2,3").ok());
+
+    comb_assert(validate(numbers, "1,2,3"));
+    comb_assert(!validate(numbers, "1,2,3;"));
+    comb_assert(!validate(pair, "1"));
+
+    // parse functions outside the library get real values under `validate`
+    auto const odd = Parser{[](std::string_view src) -> ParseResult<int64_t> {
+        auto const next = integer().map([](int64_t value) {
+            return value + 1;
+        });
+        auto result = next(src);
+
+        if (result.ok() && 0 != result.get_value() % 2) {
+            return {.value = std::nullopt, .tail = src};
+        }
+
+        return result;
+    }};
+    auto const odds = list(odd, character(','));
+
+    for (auto const src : {"1", "2", "1,3", "1,2", "3,5,7"}) {
+        auto const result = odds(src);
+
+        comb_assert_eq(validate(odds, src), result.ok() && result.tail.empty());
+        comb_assert_eq(recognize(odds)(src).tail, result.tail);
+    }
+
+    comb_assert(validate(odds, "1,3"));
+    comb_assert(!validate(odds, "1,2"));
+}
+
 }  // namespace comb_test
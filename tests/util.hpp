@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <cstdlib>
 #include <string_view>
 #include <fmt/printf.h>
 #include <fmt/color.h>
@@ -10,6 +11,7 @@
 
 template <std::invocable F>
 inline auto perform_test_impl(F test, std::string_view name) -> void {
+#ifdef __cpp_exceptions
     try {
         fmt::print(stderr, "test {:.^48}", name);
 
@@ -24,4 +26,12 @@ inline auto perform_test_impl(F test, std::string_view name) -> void {
 
         exit(EXIT_FAILURE);
     }
+#else
+    // a failing assertion exits right away, see `comb_fail`
+    fmt::print(stderr, "test {:.^48}", name);
+
+    test();
+
+    fmt::print(stderr, fmt::fg(fmt::color::lime_green), " passed\n");
+#endif
 }